@@ -177,7 +177,7 @@ class JointReadout(SpecificPopulation):
         Readout the angles from the iCub and set it as population activation.
     """
 
-    def __init__(self, geometry=None, joints=None, encoded=False, ip_address="0.0.0.0", port=50005, copied=False, name=None):
+    def __init__(self, geometry=None, joints=None, encoded=False, ip_address="0.0.0.0", port=50005, sparse=False, changed_only=False, copied=False, name=None):
         """Init the JointReadout population.
 
         Args:
@@ -186,15 +186,26 @@ class JointReadout(SpecificPopulation):
             encoded (bool, optional): Specify if the joint angles should be encoded with a population coding. Defaults to False.
             ip_address (str, optional): ip-address of the gRPC connection. Need to fit with the respective joint reader module. Defaults to "0.0.0.0".
             port (int, optional): port of the gRPC connection. Need to fit with the respective joint reader module. Defaults to 50005.
+            sparse (bool, optional): Receive only the neurons within the encoding window of the joint reader (see set_sparse_cutoff of the joint reader);
+                                     requires encoded=True and all joints. Defaults to False.
+            changed_only (bool, optional): Receive only the joints, which moved beyond their deadband (see set_deadband of the joint reader); the other joints
+                                           keep their values. Requires all joints. Defaults to False.
             copied (bool, optional): ANNarchy specific parameter. Defaults to False.
             name (str, optional): individiual name for the population. Defaults to None.
         """
         SpecificPopulation.__init__(self, geometry=geometry, neuron=Neuron(equations="r = 0.0"), copied=copied, name=name)
 
+        if sparse and (not encoded or (joints is not None and len(joints) > 0)):
+            _error("The sparse joint readout requires encoded=True and all joints.")
+        if changed_only and joints is not None and len(joints) > 0:
+            _error("The changed-only joint readout requires all joints.")
+
         self._ip_address = ip_address
         self._port = port
         self._joints = joints
         self._encoded = encoded
+        self._sparse = sparse
+        self._changed_only = changed_only
 
     def _init_attributes(self):
         SpecificPopulation._init_attributes(self)
@@ -205,7 +216,8 @@ class JointReadout(SpecificPopulation):
         self.cyInstance.set_port(self._port)
 
     def _copy(self):
-        return JointReadout(geometry=self.geometry, joints=self._joints, encoded=self._encoded, ip_address=self._ip_address, port=self._port, copied=True, name=self.name)
+        return JointReadout(geometry=self.geometry, joints=self._joints, encoded=self._encoded, ip_address=self._ip_address, port=self._port, sparse=self._sparse,
+                            changed_only=self._changed_only, copied=True, name=self.name)
 
     @property
     def ip_address(self):
@@ -354,7 +366,21 @@ class JointReadout(SpecificPopulation):
         pop%(id)s.connect()
 """ %{'id': self.id}
 
-        if len(self._joints) == 0:
+        if self._changed_only:
+            self._specific_template['update_variables'] = """
+        #pragma omp single
+        {
+        joint_source->retrieve_alljoints_changed(r, encoded, %(sparse)s);
+        }
+        """ % {'sparse': 'true' if self._sparse else 'false'}
+        elif self._sparse:
+            self._specific_template['update_variables'] = """
+        #pragma omp single
+        {
+        joint_source->retrieve_alljoints_sparse(r);
+        }
+        """
+        elif len(self._joints) == 0:
             self._specific_template['update_variables'] = """
         #pragma omp single
         {
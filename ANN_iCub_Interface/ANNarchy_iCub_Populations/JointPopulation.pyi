@@ -39,7 +39,7 @@ class JointReadout(SpecificPopulation):
         ANNarchy population class to connect with the iCub joint readout, e. g. arm or head.
         Readout the angles from the iCub and set it as population activation.
     """
-    def __init__(self, geometry: Tuple | None = ..., joints: List | None = ..., encoded: bool = ..., ip_address: str = ..., port: int = ..., copied: bool = ..., name: str | None = ...) -> None:
+    def __init__(self, geometry: Tuple | None = ..., joints: List | None = ..., encoded: bool = ..., ip_address: str = ..., port: int = ..., sparse: bool = ..., changed_only: bool = ..., copied: bool = ..., name: str | None = ...) -> None:
         '''Init the JointReadout population.
 
         Args:
@@ -48,6 +48,10 @@ class JointReadout(SpecificPopulation):
             encoded (bool, optional): Specify if the joint angles should be encoded with a population coding. Defaults to False.
             ip_address (str, optional): ip-address of the gRPC connection. Need to fit with the respective joint reader module. Defaults to "0.0.0.0".
             port (int, optional): port of the gRPC connection. Need to fit with the respective joint reader module. Defaults to 50005.
+            sparse (bool, optional): Receive only the neurons within the encoding window of the joint reader (see set_sparse_cutoff of the joint reader);
+                                     requires encoded=True and all joints. Defaults to False.
+            changed_only (bool, optional): Receive only the joints, which moved beyond their deadband (see set_deadband of the joint reader); the other joints
+                                           keep their values. Requires all joints. Defaults to False.
             copied (bool, optional): ANNarchy specific parameter. Defaults to False.
             name (str, optional): individiual name for the population. Defaults to None.
         '''
@@ -38,7 +38,8 @@ class VisionPopulation(SpecificPopulation):
         """Init the VisionPopulation.
 
         Args:
-            geometry (tuple, optional): ANNarchy population geometry. Defaults to (320,240).
+            geometry (tuple, optional): ANNarchy population geometry. Defaults to (320,240). The population size has to match the image size of the visual reader;
+                for the log-polar retina layout the geometry is (rings, wedges).
             ip_address (str, optional): ip-address of the gRPC connection. Need to fit with the respective visual reader module. Defaults to "0.0.0.0".
             port (int, optional): port of the gRPC connection. Need to fit with the respective visual reader module. Defaults to 50000.
             copied (bool, optional): ANNarchy specific parameter. Defaults to False.
@@ -118,6 +119,15 @@ class VisionPopulation(SpecificPopulation):
         else:
             _error("Changing offset is only valid after compile() or constructor.")
 
+    @property
+    def image_geometry(self):
+        """Geometry of the last received image as reported by the visual reader: (height, width, channels, layout, dtype); layout 0: cartesian, 1: log-polar;
+           dtype 0: uint8, 1: float16, 2: float32, 3: float64. The image is transferred with the dtype of the visual reader and converted to the population rates in [0, 1] (uint8 is divided by 255)."""
+        if self.initialized:
+            return tuple(self.cyInstance.get_image_geometry())
+        else:
+            _error("Read-out image geometry is only valid after compile().")
+
     def _generate(self):
         """
             read out code for iCub through gRPC
@@ -134,6 +144,7 @@ class VisionPopulation(SpecificPopulation):
     unsigned int offset;
 
     ClientInstance* image_source=nullptr;
+    bool size_mismatch=false;
         """
         self._specific_template['access_additional'] = """
     // Image Source ip address
@@ -168,6 +179,14 @@ class VisionPopulation(SpecificPopulation):
         return offset;
     }
 
+    // geometry of the last received image
+    std::vector<int> get_image_geometry() {
+        if (image_source != nullptr) {
+            return image_source->get_image_geometry();
+        }
+        return std::vector<int>();
+    }
+
     void connect() {
         if (image_source == nullptr) {
             image_source = new ClientInstance(ip_address, port);
@@ -188,6 +207,8 @@ class VisionPopulation(SpecificPopulation):
         void set_offset(unsigned int value)
         unsigned int get_offset()
 
+        vector[int] get_image_geometry()
+
         void connect()
 """
         self._specific_template['wrapper_access_additional'] = """
@@ -210,6 +231,9 @@ class VisionPopulation(SpecificPopulation):
     def get_offset(self):
         return pop%(id)s.get_offset()
 
+    def get_image_geometry(self):
+        return pop%(id)s.get_image_geometry()
+
     def connect(self):
         pop%(id)s.connect()
 """ %{'id': self.id}
@@ -218,7 +242,13 @@ class VisionPopulation(SpecificPopulation):
         #pragma omp single
         {
             if((t%period==offset) && _active){
-                r = image_source->retrieve_image();
+                auto image = image_source->retrieve_image(size);
+                if (image.size() == static_cast<size_t>(size)) {
+                    r = image;
+                } else if (!size_mismatch) {
+                    std::cerr << "VisionPopulation: received image size " << image.size() << " does not match the population size " << size << std::endl;
+                    size_mismatch = true;
+                }
             }
         }
         """
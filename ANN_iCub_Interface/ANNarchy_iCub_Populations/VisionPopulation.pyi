@@ -15,7 +15,8 @@ class VisionPopulation(SpecificPopulation):
         '''Init the VisionPopulation.
 
         Args:
-            geometry (tuple, optional): ANNarchy population geometry. Defaults to (320,240).
+            geometry (tuple, optional): ANNarchy population geometry. Defaults to (320,240). The population size has to match the image size of the visual reader;
+                for the log-polar retina layout the geometry is (rings, wedges).
             ip_address (str, optional): ip-address of the gRPC connection. Need to fit with the respective visual reader module. Defaults to "0.0.0.0".
             port (int, optional): port of the gRPC connection. Need to fit with the respective visual reader module. Defaults to 50000.
             copied (bool, optional): ANNarchy specific parameter. Defaults to False.
@@ -37,5 +38,9 @@ class VisionPopulation(SpecificPopulation):
     def offset(self): ...
     @offset.setter
     def offset(self, value) -> None: ...
+    @property
+    def image_geometry(self) -> Tuple:
+        """Geometry of the last received image as reported by the visual reader: (height, width, channels, layout, dtype); layout 0: cartesian, 1: log-polar;
+           dtype 0: uint8, 1: float16, 2: float32, 3: float64. The image is transferred with the dtype of the visual reader and converted to the population rates in [0, 1] (uint8 is divided by 255)."""
     def connect(self) -> None:
         """Connect the population to the gRPC socket. Need to be called once after compile."""
@@ -106,6 +106,10 @@ def create_robot_interface_file(filename_config: str, filename_interface: str =
                     no_error_jread = False
                 else:
                     args['ini_path'] = jread.find('ini_path').text
+                if jread.find('carrier') is not None:
+                    args['carrier'] = jread.find('carrier').text or ""
+                if jread.find('coding') is not None:
+                    args['coding'] = jread.find('coding').text or "gaussian"
                 if not jread.find('ip_address') is None:
                     args['ip_address'] = jread.find('ip_address').text
                     if not jread.find('port') is None:
@@ -159,6 +163,8 @@ def create_robot_interface_file(filename_config: str, filename_interface: str =
                     no_error_jwrite = False
                 else:
                     args['ini_path'] = jwrite.find('ini_path').text
+                if jwrite.find('carrier') is not None:
+                    args['carrier'] = jwrite.find('carrier').text or ""
                 if not jwrite.find('ip_address') is None:
                     args['ip_address'] = jwrite.find('ip_address').text
                     if not jwrite.find('port') is None:
@@ -223,6 +229,8 @@ def create_robot_interface_file(filename_config: str, filename_interface: str =
                     no_error_vread = False
                 else:
                     args['ini_path'] = vread.find('ini_path').text
+                if vread.find('carrier') is not None:
+                    args['carrier'] = vread.find('carrier').text or ""
                 if not vread.find('ip_address') is None:
                     args['ip_address'] = vread.find('ip_address').text
                     if not vread.find('port') is None:
@@ -265,6 +273,8 @@ def create_robot_interface_file(filename_config: str, filename_interface: str =
                     no_error_sread = False
                 else:
                     args['ini_path'] = sread.find('ini_path').text
+                if sread.find('carrier') is not None:
+                    args['carrier'] = sread.find('carrier').text or ""
                 if not sread.find('ip_address') is None:
                     args['ip_address'] = sread.find('ip_address').text
                     if not sread.find('port') is None:
@@ -307,6 +317,8 @@ def create_robot_interface_file(filename_config: str, filename_interface: str =
                     no_error_kread = False
                 else:
                     args['ini_path'] = kread.find('ini_path').text
+                if kread.find('carrier') is not None:
+                    args['carrier'] = kread.find('carrier').text or ""
                 if kread.find('offline_mode') is None:
                     print(args['name'], "Standard value for element 'offline_mode' is used.")
                     args['offline_mode'] = False
@@ -354,6 +366,8 @@ def create_robot_interface_file(filename_config: str, filename_interface: str =
                     no_error_kwrite = False
                 else:
                     args['ini_path'] = kwrite.find('ini_path').text
+                if kwrite.find('carrier') is not None:
+                    args['carrier'] = kwrite.find('carrier').text or ""
                 if not kwrite.find('ip_address') is None:
                     args['ip_address'] = kwrite.find('ip_address').text
                     if not kwrite.find('port') is None:
@@ -442,6 +456,10 @@ def init_robot_from_file(iCub: ANNiCub_wrapper, xml_file: str) -> Tuple[bool, di
                     no_error_jread = False
                 else:
                     args['ini_path'] = jread.find('ini_path').text
+                if jread.find('carrier') is not None:
+                    args['carrier'] = jread.find('carrier').text or ""
+                if jread.find('coding') is not None:
+                    args['coding'] = jread.find('coding').text or "gaussian"
                 if jread.find('ip_address') is not None:
                     args['ip_address'] = jread.find('ip_address').text
                     if jread.find('port') is not None:
@@ -489,6 +507,8 @@ def init_robot_from_file(iCub: ANNiCub_wrapper, xml_file: str) -> Tuple[bool, di
                     no_error_jwrite = False
                 else:
                     args['ini_path'] = jwrite.find('ini_path').text
+                if jwrite.find('carrier') is not None:
+                    args['carrier'] = jwrite.find('carrier').text or ""
                 if jwrite.find('ip_address') is not None:
                     args['ip_address'] = jwrite.find('ip_address').text
                     if jwrite.find('port') is not None:
@@ -542,6 +562,8 @@ def init_robot_from_file(iCub: ANNiCub_wrapper, xml_file: str) -> Tuple[bool, di
                     no_error_vread = False
                 else:
                     args['ini_path'] = vread.find('ini_path').text
+                if vread.find('carrier') is not None:
+                    args['carrier'] = vread.find('carrier').text or ""
                 if vread.find('ip_address') is not None:
                     args['ip_address'] = vread.find('ip_address').text
                     if vread.find('port') is not None:
@@ -584,6 +606,8 @@ def init_robot_from_file(iCub: ANNiCub_wrapper, xml_file: str) -> Tuple[bool, di
                     no_error_sread = False
                 else:
                     args['ini_path'] = sread.find('ini_path').text
+                if sread.find('carrier') is not None:
+                    args['carrier'] = sread.find('carrier').text or ""
                 if sread.find('ip_address') is not None:
                     args['ip_address'] = sread.find('ip_address').text
                     if sread.find('port') is not None:
@@ -621,6 +645,8 @@ def init_robot_from_file(iCub: ANNiCub_wrapper, xml_file: str) -> Tuple[bool, di
                     no_error_kread = False
                 else:
                     args['ini_path'] = kread.find('ini_path').text
+                if kread.find('carrier') is not None:
+                    args['carrier'] = kread.find('carrier').text or ""
                 if kread.find('offline_mode') is not None:
                     args['offline_mode'] = eval(kread.find('offline_mode').text.capitalize())
 
@@ -661,6 +687,8 @@ def init_robot_from_file(iCub: ANNiCub_wrapper, xml_file: str) -> Tuple[bool, di
                     no_error_kwrite = False
                 else:
                     args['ini_path'] = kwrite.find('ini_path').text
+                if kwrite.find('carrier') is not None:
+                    args['carrier'] = kwrite.find('carrier').text or ""
                 if kwrite.find('ip_address') is not None:
                     args['ip_address'] = kwrite.find('ip_address').text
                     if kwrite.find('port') is not None:
@@ -2,10 +2,49 @@
 
 #include <grpc++/grpc++.h>
 
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <random>
+#include <utility>
+#include <vector>
+
 #include "ANN_iCub_Interface/grpc/icub.grpc.pb.h"
 
 class ClientInstance {
     std::unique_ptr<iCubInterfaceMessages::ProvideInput::Stub> stub_;
+    std::vector<int> image_geometry;    // geometry of the last received image: height, width, channels, layout, dtype
+    std::vector<std::pair<int, int>> sparse_windows;    // (start, count) of the last received sparse population code
+    std::vector<std::pair<int, int>> changed_windows;   // (start, count) per joint of the changed-only readout; empty -> resync
+    uint64_t consumer_id;                               // id of the change state on the server; channels may share one connection
+
+    // convert an IEEE 754 half precision value to double
+    static double half_to_double(uint16_t h) {
+        int exponent = (h >> 10) & 0x1f;
+        int mantissa = h & 0x3ff;
+        double value;
+        if (exponent == 0) {
+            value = std::ldexp(mantissa, -24);
+        } else if (exponent == 31) {
+            value = mantissa ? NAN : INFINITY;
+        } else {
+            value = std::ldexp(mantissa + 1024, exponent - 25);
+        }
+        return (h & 0x8000) ? -value : value;
+    }
+
+    // convert the raw image data with the given element type to double values, multiplied by the given scale
+    template <typename T>
+    static std::vector<double> decode_image(const std::string &raw, double scale = 1.) {
+        std::vector<double> image(raw.size() / sizeof(T));
+        for (size_t i = 0; i < image.size(); i++) {
+            T value;
+            std::memcpy(&value, raw.data() + i * sizeof(T), sizeof(T));
+            image[i] = scale * static_cast<double>(value);
+        }
+        return image;
+    }
 
  public:
     ClientInstance(std::string ip_address, unsigned int port) {
@@ -14,10 +53,13 @@ class ClientInstance {
 
         stub_ = iCubInterfaceMessages::ProvideInput::NewStub(channel);
 
+        std::random_device rd;
+        consumer_id = (static_cast<uint64_t>(rd()) << 32) | rd();
+
         std::cout << "Client connects to " << server_str << std::endl;
     }
 
-    std::vector<double> retrieve_image() {
+    std::vector<double> retrieve_image(size_t fallback_size = 320 * 240) {
         iCubInterfaceMessages::ImageRequest request;
         iCubInterfaceMessages::ImageResponse response;
 
@@ -27,13 +69,32 @@ class ClientInstance {
         auto state = stub_->ReadImage(&context, request, &response);
 
         if (state.ok()) {
-            return std::vector<double>(response.imagel().begin(), response.imagel().end());
+            image_geometry = {response.height(), response.width(), response.channels(), static_cast<int>(response.layout()),
+                              static_cast<int>(response.dtype())};
+            switch (response.dtype()) {
+                case iCubInterfaceMessages::UINT8:
+                    // [0, 255] -> [0, 1], same range as the floating point images
+                    return decode_image<uint8_t>(response.image(), 1. / 255.);
+                case iCubInterfaceMessages::FLOAT16: {
+                    auto bits = decode_image<uint16_t>(response.image());
+                    for (auto &value : bits) {
+                        value = half_to_double(static_cast<uint16_t>(value));
+                    }
+                    return bits;
+                }
+                case iCubInterfaceMessages::FLOAT32:
+                    return decode_image<float>(response.image());
+                default:
+                    return decode_image<double>(response.image());
+            }
         } else {
             std::cerr << "ClientInstance::retrieve_image() failed: " << state.error_message() << std::endl;
-            return std::vector<double>(320 * 240, 0.0);    // TODO: make dependent from Population geometry
+            return std::vector<double>(fallback_size, 0.0);
         }
     }
 
+    std::vector<int> get_image_geometry() { return image_geometry; }
+
     std::vector<int> retrieve_rgbimage() {
         iCubInterfaceMessages::ImageRequest request;
         iCubInterfaceMessages::RgbImageResponse response;
@@ -105,6 +166,96 @@ class ClientInstance {
         }
     }
 
+    // receive the sparse population code of all joints and write it into r; only the windows of the last and the current
+    // response are touched, the remaining neurons stay zero
+    bool retrieve_alljoints_sparse(std::vector<double> &r) {
+        iCubInterfaceMessages::AllJointsRequest request;
+        request.set_encode(true);
+        request.set_sparse(true);
+        iCubInterfaceMessages::AllJointsResponse response;
+
+        grpc::ClientContext context;
+
+        auto state = stub_->ReadAllJoints(&context, request, &response);
+
+        if (state.ok()) {
+            if (sparse_windows.empty()) {
+                std::fill(r.begin(), r.end(), 0.0);
+            }
+            for (auto &window : sparse_windows) {
+                std::fill(r.begin() + window.first, r.begin() + window.first + window.second, 0.0);
+            }
+            sparse_windows.clear();
+
+            int offset = 0;
+            for (int j = 0; j < response.start_size() && j < response.count_size(); j++) {
+                int start = response.start(j);
+                int count = response.count(j);
+                if (start < 0 || count < 0 || static_cast<size_t>(start + count) > r.size() || offset + count > response.angle_size()) {
+                    std::cerr << "ClientInstance::retrieve_alljoints_sparse() failed: population code does not fit the population size" << std::endl;
+                    // the previous windows are already written -> no partially updated population
+                    std::fill(r.begin(), r.end(), 0.0);
+                    sparse_windows.clear();
+                    return false;
+                }
+                std::copy(response.angle().begin() + offset, response.angle().begin() + offset + count, r.begin() + start);
+                sparse_windows.emplace_back(start, count);
+                offset += count;
+            }
+            return true;
+        } else {
+            std::cerr << "ClientInstance::retrieve_alljoints_sparse() failed: " << state.error_message() << std::endl;
+            return false;
+        }
+    }
+
+    // receive the joints, which moved beyond their deadband, and write them into r; the unchanged joints keep their values.
+    // The first request receives all joints.
+    bool retrieve_alljoints_changed(std::vector<double> &r, bool encode, bool sparse) {
+        iCubInterfaceMessages::AllJointsRequest request;
+        request.set_encode(encode);
+        request.set_sparse(sparse);
+        request.set_changed_only(true);
+        request.set_resync(changed_windows.empty());
+        request.set_consumer(consumer_id);
+        iCubInterfaceMessages::AllJointsResponse response;
+
+        grpc::ClientContext context;
+
+        auto state = stub_->ReadAllJoints(&context, request, &response);
+
+        if (state.ok()) {
+            if (changed_windows.empty()) {
+                std::fill(r.begin(), r.end(), 0.0);
+            }
+
+            int offset = 0;
+            for (int j = 0; j < response.joint_size() && j < response.start_size() && j < response.count_size(); j++) {
+                int joint = response.joint(j);
+                int start = response.start(j);
+                int count = response.count(j);
+                if (joint < 0 || start < 0 || count < 0 || static_cast<size_t>(start + count) > r.size() || offset + count > response.angle_size()) {
+                    std::cerr << "ClientInstance::retrieve_alljoints_changed() failed: joint data does not fit the population size" << std::endl;
+                    changed_windows.clear();
+                    return false;
+                }
+                if (static_cast<size_t>(joint) >= changed_windows.size()) {
+                    changed_windows.resize(joint + 1, std::make_pair(0, 0));
+                }
+                // clear the previous window of the joint, the new window may be shifted
+                auto &window = changed_windows[joint];
+                std::fill(r.begin() + window.first, r.begin() + window.first + window.second, 0.0);
+                std::copy(response.angle().begin() + offset, response.angle().begin() + offset + count, r.begin() + start);
+                window = std::make_pair(start, count);
+                offset += count;
+            }
+            return true;
+        } else {
+            std::cerr << "ClientInstance::retrieve_alljoints_changed() failed: " << state.error_message() << std::endl;
+            return false;
+        }
+    }
+
     std::vector<double> retrieve_skin_arm() {
         iCubInterfaceMessages::SkinArmRequest request;
         iCubInterfaceMessages::SkinResponse response;
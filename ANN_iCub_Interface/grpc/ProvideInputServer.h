@@ -21,9 +21,16 @@ class ProvideInputServiceImpl final : public iCubInterfaceMessages::ProvideInput
 
     grpc::Status ReadImage(grpc::ServerContext *context, const iCubInterfaceMessages::ImageRequest *request,
                            iCubInterfaceMessages::ImageResponse *response) override {
-        auto image = interface_instance->provideData();
-        google::protobuf::RepeatedField<double> data(image.begin(), image.end());
-        response->mutable_imagel()->Swap(&data);
+        auto image = interface_instance->provideRawData();
+        response->set_image(image.data(), image.size());
+        auto geometry = interface_instance->provideImageGeometry();
+        if (geometry.size() == 5) {
+            response->set_height(geometry[0]);
+            response->set_width(geometry[1]);
+            response->set_channels(geometry[2]);
+            response->set_layout(static_cast<iCubInterfaceMessages::ImageLayout>(geometry[3]));
+            response->set_dtype(static_cast<iCubInterfaceMessages::ImageDType>(geometry[4]));
+        }
         return grpc::Status::OK;
     }
 
@@ -54,6 +61,31 @@ class ProvideInputServiceImpl final : public iCubInterfaceMessages::ProvideInput
 
     grpc::Status ReadAllJoints(grpc::ServerContext *context, const iCubInterfaceMessages::AllJointsRequest *request,
                                iCubInterfaceMessages::AllJointsResponse *response) override {
+        if (request->changed_only()) {
+            std::vector<int> joint, start, count;
+            // every client instance has its own change state
+            auto values = interface_instance->provideChangedData(request->consumer(), request->encode(), request->sparse(), request->resync(), joint, start, count);
+            google::protobuf::RepeatedField<double> data(values.begin(), values.end());
+            response->mutable_angle()->Swap(&data);
+            google::protobuf::RepeatedField<int> joint_data(joint.begin(), joint.end());
+            response->mutable_joint()->Swap(&joint_data);
+            google::protobuf::RepeatedField<int> start_data(start.begin(), start.end());
+            response->mutable_start()->Swap(&start_data);
+            google::protobuf::RepeatedField<int> count_data(count.begin(), count.end());
+            response->mutable_count()->Swap(&count_data);
+            return grpc::Status::OK;
+        }
+        if (request->encode() && request->sparse()) {
+            std::vector<int> start, count;
+            auto values = interface_instance->provideSparseData(start, count);
+            google::protobuf::RepeatedField<double> data(values.begin(), values.end());
+            response->mutable_angle()->Swap(&data);
+            google::protobuf::RepeatedField<int> start_data(start.begin(), start.end());
+            response->mutable_start()->Swap(&start_data);
+            google::protobuf::RepeatedField<int> count_data(count.begin(), count.end());
+            response->mutable_count()->Swap(&count_data);
+            return grpc::Status::OK;
+        }
         auto angles = interface_instance->provideData(request->encode());
         google::protobuf::RepeatedField<double> data(angles.begin(), angles.end());
         response->mutable_angle()->Swap(&data);
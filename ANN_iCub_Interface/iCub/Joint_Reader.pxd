@@ -23,6 +23,7 @@
  """
 
 from typing import overload
+from libc.stdint cimport uint8_t
 from libcpp.string cimport string
 from libcpp.vector cimport vector
 from libcpp cimport bool as bool_t
@@ -37,10 +38,10 @@ cdef extern from "Joint_Reader.hpp":
         JointReader() except +
 
         # Initialize the joint reader with given parameters
-        bool_t Init(string, double, unsigned int, double, string)
+        bool_t Init(string, double, unsigned int, double, string, string, string)
 
         # Initialize the joint reader with given parameters and grpc communication.
-        bool_t InitGRPC(string, double, unsigned int, double, string, string, unsigned int)
+        bool_t InitGRPC(string, double, unsigned int, double, string, string, unsigned int, string, string)
 
         # Close joint reader with cleanup
         void Close()
@@ -48,12 +49,54 @@ cdef extern from "Joint_Reader.hpp":
         # Return number of controlled joints
         int GetJointCount()
 
+        # Select the sampling mode (background sampling or robot request per reading).
+        bool_t SetSamplingMode(bool_t, double)
+
+        # Select the streaming mode (joint state stream or control board device).
+        bool_t SetStreamingMode(bool_t)
+
+        # Keep the history of the joint angles in a ring buffer, filled by the sampler thread.
+        bool_t SetHistory(unsigned int, double)
+
+        # Return the number of samples in the history
+        unsigned int GetHistoryLength()
+
+        # Copy the last n samples of the history into preallocated buffers (angles, timestamps).
+        int ReadHistoryLastInto(unsigned int, double*, double*, size_t)
+
+        # Copy the samples of the history newer than the given time into preallocated buffers (angles, timestamps).
+        int ReadHistorySinceInto(double, double*, double*, size_t)
+
+        # Read the joint state of all joints (positions, velocities, accelerations, timestamp).
+        bool_t ReadStateAll(double*, double*, double*, double*)
+
+        # Read the joint state of all joints into one buffer (timestamps, angles, velocities, accelerations).
+        bool_t ReadStateAllInto(double*, size_t)
+
         # Return the resolution in degree of the populations encoding the joint angles.
         vector[double] GetJointsDegRes()
 
         # Return the size of the populations encoding the joint angles
         vector[unsigned int] GetNeuronsPerJoint()
 
+        # Return the size of the largest population
+        unsigned int GetMaxNeuronsPerJoint()
+
+        # Restrict the population coding to the neurons within cutoff * sigma of the joint angle
+        bool_t SetSparseCutoff(double)
+
+        # Return the maximum number of neurons within the encoding window
+        unsigned int GetSparseWidth()
+
+        # Set the deadbands of the joints for the change detection
+        bool_t SetDeadband(vector[double], bool_t)
+
+        # Return the deadbands of the joints
+        vector[double] GetDeadband()
+
+        # Read all joints and write the changed mask since the last call into a preallocated buffer
+        int ReadChangedMaskInto(uint8_t*, size_t)
+
         # Read all joints and return joint angles directly in degree as double values
         vector[double] ReadDoubleAll()
 
@@ -66,6 +109,18 @@ cdef extern from "Joint_Reader.hpp":
         # Read all joints and return the joint angles encoded in populations.
         vector[vector[double]] ReadPopAll()
 
+        # Read all joints and write the joint angles in degree into a preallocated buffer.
+        bool_t ReadDoubleAllInto(double*, size_t)
+
+        # Read all joints and write the joint angles encoded in populations into a preallocated buffer.
+        bool_t ReadPopAllInto(double*, size_t)
+
+        # Read all joints and write the sparse population code (start index, count, window values) into preallocated buffers.
+        bool_t ReadPopAllSparseInto(int*, int*, double*, size_t)
+
+        # Read all joints and draw one time step of Poisson spike trains from the population code (spike indices).
+        int ReadPopAllSpikesInto(int*, size_t, double, double)
+
         # Read multiple joints and return the joint angles encoded in populations.
         vector[vector[double]] ReadPopMultiple(vector[int])
 
@@ -77,5 +132,43 @@ cdef extern from "Joint_Reader.hpp":
 
         # cmap[string, string] getParameter()
 
+cdef extern from "Multi_Joint_Reader.hpp":
+
+    cdef cppclass MultiJointReader(Mod_BaseClass):
+        MultiJointReader() except +
+
+        # Initialize the multi-part joint reader with given parameters
+        bool_t Init(vector[string], double, unsigned int, double, string, string, string)
+
+        # Close multi-part joint reader with cleanup
+        void Close()
+
+        # Select the sampling mode of all parts.
+        bool_t SetSamplingMode(bool_t, double)
+
+        # Return the robot parts in the output order
+        vector[string] GetParts()
+
+        # Return the number of joints of all parts
+        int GetJointCount()
+
+        # Return the offset table of the parts (first joint of every part, number of joints)
+        vector[int] GetJointOffsets()
+
+        # Return the size of the largest population of all parts
+        unsigned int GetMaxNeuronsPerJoint()
+
+        # Read all joints of all parts and return joint angles directly in degree as double values
+        vector[double] ReadDoubleAll()
+
+        # Read all joints of all parts and write the joint angles in degree into a preallocated buffer.
+        bool_t ReadDoubleAllInto(double*, size_t)
+
+        # Read all joints of all parts and write the joint angles encoded in populations into a preallocated buffer.
+        bool_t ReadPopAllInto(double*, size_t)
+
 cdef class PyJointReader(PyModuleBase):
-    cdef shared_ptr[JointReader] _cpp_joint_reader
\ No newline at end of file
+    cdef shared_ptr[JointReader] _cpp_joint_reader
+
+cdef class PyMultiJointReader(PyModuleBase):
+    cdef shared_ptr[MultiJointReader] _cpp_multi_joint_reader
\ No newline at end of file
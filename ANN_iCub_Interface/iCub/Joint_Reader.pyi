@@ -22,6 +22,97 @@ class PyJointReader:
         """
         ...
 
+    def create_history_buffers(self) -> tuple:
+        """Return new arrays fitting the whole history. Can be used as reusable buffers with read_history_last_into and read_history_since_into.
+
+        Parameters
+        ----------
+
+        Returns
+        -------
+        tuple
+            (values, timestamps): zero initialized float64 arrays with the shapes (history length, joints) and (history length,)
+        """
+        ...
+
+    def create_pop_buffer(self) -> ndarray:
+        """Return a new array fitting the population code of all joints. Can be used as reusable buffer with read_pop_all_into.
+
+        Parameters
+        ----------
+
+        Returns
+        -------
+        NDarray
+            zero initialized float64 array with the shape (joints, max. neurons per joint)
+        """
+        ...
+
+    def create_sparse_buffers(self) -> tuple:
+        """Return new arrays fitting the sparse population code of all joints. Can be used as reusable buffers with read_pop_all_sparse_into.
+
+        Parameters
+        ----------
+
+        Returns
+        -------
+        tuple
+            (start, count, values): int32 arrays with the shape (joints,) and a zero initialized float64 array with the shape (joints, sparse width)
+        """
+        ...
+
+    def create_spike_buffer(self) -> ndarray:
+        """Return a new array fitting the spike indices of all joint populations. Can be used as reusable buffer with read_pop_all_spikes_into.
+
+        Parameters
+        ----------
+
+        Returns
+        -------
+        NDarray
+            int32 array with joints x max. neurons per joint elements
+        """
+        ...
+
+    def create_state_buffer(self) -> ndarray:
+        """Return a new array fitting the joint state of all joints. Can be used as reusable buffer with read_state_all_into.
+
+        Parameters
+        ----------
+
+        Returns
+        -------
+        NDarray
+            zero initialized float64 array with the shape (4, joints)
+        """
+        ...
+
+    def get_deadband(self) -> ndarray:
+        """Return the deadbands of the joints.
+
+        Parameters
+        ----------
+
+        Returns
+        -------
+        NDarray
+            deadband in degree per joint
+        """
+        ...
+
+    def get_history_length(self) -> int:
+        """Return the number of samples in the history.
+
+        Parameters
+        ----------
+
+        Returns
+        -------
+        int
+            number of samples; 0 if no history is recorded
+        """
+        ...
+
     def get_joint_count(self) -> int:
         """Return the number of controlled joints
 
@@ -48,6 +139,19 @@ class PyJointReader:
         """
         ...
 
+    def get_max_neurons_per_joint(self) -> int:
+        """Return the size of the largest population encoding a joint angle -> row length of the population buffer
+
+        Parameters
+        ----------
+
+        Returns
+        -------
+        int
+            maximum number of neurons per joint
+        """
+        ...
+
     def get_neurons_per_joint(self) -> ndarray:
         """Return the size of the populations encoding the joint angles
 
@@ -61,8 +165,21 @@ class PyJointReader:
         """
         ...
 
+    def get_sparse_width(self) -> int:
+        """Return the maximum number of neurons within the encoding window -> row length of the sparse value buffer
+
+        Parameters
+        ----------
+
+        Returns
+        -------
+        int
+            maximum number of encoded neurons per joint
+        """
+        ...
+
     def init(self, iCub: ANNiCub_wrapper, name: str, part: str, sigma: float,
-             n_pop: int, degr_per_neuron: float = ..., ini_path: str = ...) -> bool:
+             n_pop: int, degr_per_neuron: float = ..., ini_path: str = ..., carrier: str = ..., coding: str = ...) -> bool:
         """Initialize the joint reader with given parameters.
 
         Parameters
@@ -82,6 +199,10 @@ class PyJointReader:
             if set: population size depends on joint working range. (Default value = 0.0)
         ini_path : str
             Path to the "interface_param.ini"-file. (Default value = "../data/")
+        carrier : str
+            YARP carrier for the robot connections, e.g. tcp, fast_tcp, shmem, udp; empty: carrier option of the ini file. (Default value = "")
+        coding : str
+            population coding of the joint angles: gaussian, von_mises (wrap-around joints, period 360 degree) or thermometer. (Default value = "gaussian")
 
         Returns
         -------
@@ -92,7 +213,7 @@ class PyJointReader:
         ...
 
     def init_grpc(self, iCub: ANNiCub_wrapper, name: str, part: str, sigma: float, n_pop: int,
-                  degr_per_neuron: float = ..., ini_path: str = ..., ip_address: str = ..., port: int = ...) -> bool:
+                  degr_per_neuron: float = ..., ini_path: str = ..., ip_address: str = ..., port: int = ..., carrier: str = ..., coding: str = ...) -> bool:
         """Initialize the joint reader with given parameters, including the gRPC based connection.
 
         Parameters
@@ -116,6 +237,10 @@ class PyJointReader:
             gRPC server ip address. (Default value = "0.0.0.0")
         port : unsigned int
             gRPC server port. (Default value = 50005)
+        carrier : str
+            YARP carrier for the robot connections, e.g. tcp, fast_tcp, shmem, udp; empty: carrier option of the ini file. (Default value = "")
+        coding : str
+            population coding of the joint angles: gaussian, von_mises (wrap-around joints, period 360 degree) or thermometer. (Default value = "gaussian")
 
         Returns
         -------
@@ -125,6 +250,36 @@ class PyJointReader:
         """
         ...
 
+    def read_changed_mask(self) -> ndarray:
+        """Read all joints and return the changed mask: True for the joints, which moved beyond their deadband since the last call of
+           read_changed_mask/read_changed_mask_into. Independent of the other readings.
+
+        Parameters
+        ----------
+
+        Returns
+        -------
+        NDarray
+            bool array with one element per joint; empty array at error
+        """
+        ...
+
+    def read_changed_mask_into(self, out: ndarray) -> int:
+        """Read all joints and write the changed mask into a preallocated array, without memory allocation: the joints, which moved beyond
+           their deadband since the last call of read_changed_mask/read_changed_mask_into. Independent of the other readings.
+
+        Parameters
+        ----------
+        out : NDarray
+            C-contiguous bool or uint8 array with one element per joint
+
+        Returns
+        -------
+        int
+            number of changed joints; -1 at error
+        """
+        ...
+
     def read_double_all(self) -> ndarray:
         """Read all joints and return joint angles directly as double values
 
@@ -168,6 +323,44 @@ class PyJointReader:
         """
         ...
 
+    def read_history_last_into(self, n: int, out: ndarray, timestamps: ndarray) -> int:
+        """Copy the last n samples of the history into preallocated arrays, oldest sample first, without memory allocation.
+
+        Parameters
+        ----------
+        n : unsigned int
+            number of samples; n <= history length
+        out : NDarray
+            C-contiguous float64 array with at least n rows of joint angles, e.g. the values array returned by create_history_buffers
+        timestamps : NDarray
+            C-contiguous float64 array with at least n elements for the sample timestamps in seconds, e.g. the timestamps array returned by create_history_buffers
+
+        Returns
+        -------
+        int
+            number of copied samples -> valid rows out[:count]; -1 at error
+        """
+        ...
+
+    def read_history_since_into(self, since: float, out: ndarray, timestamps: ndarray) -> int:
+        """Copy the samples of the history newer than the given time into preallocated arrays, oldest sample first, without memory allocation.
+
+        Parameters
+        ----------
+        since : double
+            time limit in seconds (clock of the sample timestamps); samples with a timestamp > since are copied
+        out : NDarray
+            C-contiguous float64 array with history length rows of joint angles, e.g. the values array returned by create_history_buffers
+        timestamps : NDarray
+            C-contiguous float64 array with history length elements for the sample timestamps in seconds, e.g. the timestamps array returned by create_history_buffers
+
+        Returns
+        -------
+        int
+            number of copied samples -> valid rows out[:count]; -1 at error
+        """
+        ...
+
     def read_pop_all(self) -> ndarray:
         """Read all joints and return the joint angles encoded in vectors (population coding)
 
@@ -181,6 +374,92 @@ class PyJointReader:
         """
         ...
 
+    def read_pop_all_into(self, out: ndarray) -> bool:
+        """Read all joints and write the joint angles encoded in populations into a preallocated array, without memory allocation.
+           The rows of joints with smaller populations are zero padded.
+
+        Parameters
+        ----------
+        out : NDarray
+            C-contiguous float64 array with the shape (joints, max. neurons per joint), e.g. the array returned by create_pop_buffer
+
+        Returns
+        -------
+        bool
+            return True/False, indicating success/failure
+        """
+        ...
+
+    def read_pop_all_sparse(self) -> list:
+        """Read all joints and return the sparse population code.
+
+        Parameters
+        ----------
+
+        Returns
+        -------
+        list
+            one tuple (start, values) per joint: index of the first encoded neuron and the values of the encoding window (NDarray)
+        """
+        ...
+
+    def read_pop_all_sparse_into(self, start: ndarray, count: ndarray, values: ndarray) -> bool:
+        """Read all joints and write the sparse population code into preallocated arrays, without memory allocation.
+           Row j of values holds count[j] values for the neurons start[j] ... start[j] + count[j] - 1 of the joint population.
+
+        Parameters
+        ----------
+        start : NDarray
+            C-contiguous int32 array with the shape (joints,) for the index of the first encoded neuron
+        count : NDarray
+            C-contiguous int32 array with the shape (joints,) for the number of encoded neurons
+        values : NDarray
+            C-contiguous float64 array with the shape (joints, sparse width), e.g. the arrays returned by create_sparse_buffers
+
+        Returns
+        -------
+        bool
+            return True/False, indicating success/failure
+        """
+        ...
+
+    def read_pop_all_spikes(self, max_rate: float, dt: float) -> ndarray:
+        """Read all joints and draw one time step of Poisson spike trains from the population code.
+
+        Parameters
+        ----------
+        max_rate : double
+            firing rate in Hz of a neuron with the population code value 1
+        dt : double
+            length of the time step in seconds
+
+        Returns
+        -------
+        NDarray
+            int32 indices of the spiking neurons in the (joints, max. neurons per joint) population array; empty array at error
+        """
+        ...
+
+    def read_pop_all_spikes_into(self, out: ndarray, max_rate: float, dt: float) -> int:
+        """Read all joints and draw one time step of Poisson spike trains from the population code, without memory allocation.
+           Neuron i spikes with the probability rate_i * max_rate * dt, with the population code value rate_i in [0, 1].
+
+        Parameters
+        ----------
+        out : NDarray
+            C-contiguous int32 array with joints x max. neurons per joint elements, e.g. the array returned by create_spike_buffer
+        max_rate : double
+            firing rate in Hz of a neuron with the population code value 1
+        dt : double
+            length of the time step in seconds
+
+        Returns
+        -------
+        int
+            number of spiking neurons -> out[:count] holds the indices in the (joints, max. neurons per joint) population array in ascending order; -1 at error
+        """
+        ...
+
     def read_pop_multiple(self, joints) -> ndarray:
         """Read multiple joints and return the joint angles encoded in vectors (population coding).
 
@@ -210,3 +489,307 @@ class PyJointReader:
             population vector encoding the joint angle
         """
         ...
+
+    def read_state_all(self) -> tuple | None:
+        """Read the joint state of all joints: joint angles, velocities and accelerations from one request, or the newest sample in the sampling/streaming mode.
+
+        Parameters
+        ----------
+
+        Returns
+        -------
+        tuple
+            (timestamp, positions, velocities, accelerations): newest robot-side timestamp of the joints in seconds and NDarrays with the joint angles in degree,
+            the joint velocities in degree/s and the joint accelerations in degree/s^2; None, if the state is not available
+        """
+        ...
+
+    def read_state_all_into(self, out: ndarray) -> bool:
+        """Read the joint state of all joints into a preallocated array, without memory allocation. The rows are the robot-side timestamps of the joints
+           in seconds, the joint angles in degree, the joint velocities in degree/s and the joint accelerations in degree/s^2; in the sampling/streaming
+           mode all joints carry the sample timestamp.
+
+        Parameters
+        ----------
+        out : NDarray
+            C-contiguous float64 array with the shape (4, joints), e.g. the array returned by create_state_buffer
+
+        Returns
+        -------
+        bool
+            return True/False, indicating success/failure
+        """
+        ...
+
+    def set_deadband(self, deadband, cache_pop: bool = ...) -> bool:
+        """Set the deadbands of the joints for the change detection: a joint counts as changed, if its angle moved more than its deadband since it was
+           last reported as changed to the same consumer (read_changed_mask, every changed-only gRPC client); the other readings do not consume changes.
+           With the population cache, the population readings of all joints return the cached population of the last held angle for joints within
+           their deadband instead of encoding the new angle.
+
+        Parameters
+        ----------
+        deadband : double | list
+            deadband in degree; one value for all joints or one value per joint; empty list -> no deadband, every movement counts
+        cache_pop : bool
+            reuse the cached population of unchanged joints. (Default value = False)
+
+        Returns
+        -------
+        bool
+            return True/False, indicating success/failure
+        """
+        ...
+
+    def set_history(self, length: int, rate: float = ...) -> bool:
+        """Keep the history of the joint angles in a preallocated ring buffer, filled by the sampler thread; enables the sampling mode with the given rate.
+           Switching the sampling mode off stops the recording, the recorded samples stay readable.
+
+        Parameters
+        ----------
+        length : unsigned int
+            number of samples in the history; 0 -> no history (the sampling mode stays as it is)
+        rate : double
+            sampling rate in Hz of the history. (Default value = 1000.0)
+
+        Returns
+        -------
+        bool
+            return True/False, indicating success/failure
+        """
+        ...
+
+    def set_sampling_mode(self, threaded: bool, rate: float = ...) -> bool:
+        """Select the sampling mode. In threaded mode a sampler thread polls the joint encoders with the given rate and all read calls
+           return the newest sample at once, without a request to the robot; the timestamps of the timed reads are the sample times.
+
+        Parameters
+        ----------
+        threaded : bool
+            True for the background sampling; False to request the joint angles from the robot with every read call
+        rate : double
+            sampling rate in Hz of the background sampling. (Default value = 1000.0)
+
+        Returns
+        -------
+        bool
+            return True/False, indicating success/failure
+        """
+        ...
+
+    def set_sparse_cutoff(self, cutoff: float) -> bool:
+        """Restrict the population coding to the neurons within cutoff * sigma of the joint angle. The other neurons are set to zero
+           without evaluation; this also applies to the dense readings. Only available for the Gaussian coding.
+
+        Parameters
+        ----------
+        cutoff : double
+            half width of the encoding window in multiples of sigma; 0 restores the default window of 8 sigma
+
+        Returns
+        -------
+        bool
+            return True/False, indicating success/failure
+        """
+        ...
+
+    def set_streaming_mode(self, streaming: bool) -> bool:
+        """Select the streaming mode. In streaming mode the reader subscribes to the joint state stream of the control board (stateExt:o);
+           all read calls return the newest received state without a request to the robot and the timed reads return the message timestamps.
+
+        Parameters
+        ----------
+        streaming : bool
+            True to receive the joint state stream; False to read the joints through the control board device
+
+        Returns
+        -------
+        bool
+            return True/False, indicating success/failure
+        """
+        ...
+
+
+class PyMultiJointReader:
+    """ """
+    @classmethod
+    def __init__(cls, *args, **kwargs) -> None: ...
+
+    def close(self) -> NoReturn:
+        """Close multi-part joint reader with cleanup
+
+        Parameters
+        ----------
+
+        Returns
+        -------
+
+        """
+        ...
+
+    def create_double_buffer(self) -> ndarray:
+        """Return a new array fitting the joint angles of all parts. Can be used as reusable buffer with read_double_all_into.
+
+        Parameters
+        ----------
+
+        Returns
+        -------
+        NDarray
+            zero initialized float64 array with the shape (joints,)
+        """
+        ...
+
+    def create_pop_buffer(self) -> ndarray:
+        """Return a new array fitting the population code of all parts. Can be used as reusable buffer with read_pop_all_into.
+
+        Parameters
+        ----------
+
+        Returns
+        -------
+        NDarray
+            zero initialized float64 array with the shape (joints, max. neurons per joint)
+        """
+        ...
+
+    def get_joint_count(self) -> int:
+        """Return the number of joints of all parts.
+
+        Parameters
+        ----------
+
+        Returns
+        -------
+        int
+            number of joints
+        """
+        ...
+
+    def get_joint_offsets(self) -> dict:
+        """Return the offset table of the parts: the joints of a part are the entries first to end - 1 of the output.
+
+        Parameters
+        ----------
+
+        Returns
+        -------
+        dict
+            part name -> (first index, end index) in the output
+        """
+        ...
+
+    def get_max_neurons_per_joint(self) -> int:
+        """Return the size of the largest joint population of all parts -> row length of the population buffer
+
+        Parameters
+        ----------
+
+        Returns
+        -------
+        int
+            number of neurons of the largest population
+        """
+        ...
+
+    def get_parts(self) -> list:
+        """Return the robot parts in the output order.
+
+        Parameters
+        ----------
+
+        Returns
+        -------
+        list
+            robot part names
+        """
+        ...
+
+    def init(self, parts: list, sigma: float, n_pop: int, degr_per_neuron: float = ..., ini_path: str = ..., carrier: str = ..., coding: str = ...) -> bool:
+        """Initialize the multi-part joint reader with given parameters. Every part gets its own control board connection.
+
+        Parameters
+        ----------
+        parts : list
+            robot parts in the output order, have to match iCub part naming {left_(arm/leg), right_(arm/leg), head, torso}
+        sigma : double
+            sigma for the joints angles populations coding
+        n_pop : unsigned int
+            number of neurons per population, encoding each one joint angle only works if parameter "deg_per_neuron" is not set
+        degr_per_neuron : double
+            degree per neuron in the populations, encoding the joints angles
+            if set: population size depends on joint working range. (Default value = 0.0)
+        ini_path : str
+            Path to the "interface_param.ini"-file. (Default value = "../data/")
+        carrier : str
+            YARP carrier for the robot connections, e.g. tcp, fast_tcp, shmem, udp; empty: carrier option of the ini file. (Default value = "")
+        coding : str
+            population coding of the joint angles: gaussian, von_mises (wrap-around joints, period 360 degree) or thermometer. (Default value = "gaussian")
+
+        Returns
+        -------
+        bool
+            return True, if successful
+        """
+        ...
+
+    def read_double_all(self) -> ndarray:
+        """Read all joints of all parts and return joint angles directly as double values; the parts are read concurrently.
+
+        Parameters
+        ----------
+
+        Returns
+        -------
+        NDarray : vector[double]
+            joint angles read from the robot in the order of the offset table; empty vector at error
+        """
+        ...
+
+    def read_double_all_into(self, out: ndarray) -> bool:
+        """Read all joints of all parts and write the joint angles into a preallocated array, without memory allocation.
+
+        Parameters
+        ----------
+        out : NDarray
+            C-contiguous float64 array with the shape (joints,), e.g. the array returned by create_double_buffer
+
+        Returns
+        -------
+        bool
+            return True/False, indicating success/failure
+        """
+        ...
+
+    def read_pop_all_into(self, out: ndarray) -> bool:
+        """Read all joints of all parts and write the joint angles encoded in populations into a preallocated array, without memory allocation.
+           The rows of joints with smaller populations are zero padded.
+
+        Parameters
+        ----------
+        out : NDarray
+            C-contiguous float64 array with the shape (joints, max. neurons per joint), e.g. the array returned by create_pop_buffer
+
+        Returns
+        -------
+        bool
+            return True/False, indicating success/failure
+        """
+        ...
+
+    def set_sampling_mode(self, threaded: bool, rate: float = ...) -> bool:
+        """Select the sampling mode of all parts (see PyJointReader.set_sampling_mode).
+
+        Parameters
+        ----------
+        threaded : bool
+            True for the background sampling; False to request the joint angles from the robot with every read call
+        rate : double
+            sampling rate in Hz of the background sampling. (Default value = 1000.0)
+
+        Returns
+        -------
+        bool
+            return True/False, indicating success/failure
+        """
+        ...
@@ -25,11 +25,12 @@
 import numpy as np
 import tomlkit
 
+from libc.stdint cimport uint8_t
 from libcpp.memory cimport make_shared
 
 from cython.operator cimport dereference as deref
 
-from .Joint_Reader cimport JointReader
+from .Joint_Reader cimport JointReader, MultiJointReader
 from .iCub_Interface cimport ANNiCub_wrapper
 from .Module_Base_Class cimport PyModuleBase
 
@@ -116,7 +117,7 @@ cdef class PyJointReader:
     '''
 
     # Initialize the joint reader with given parameters
-    def init(self, ANNiCub_wrapper iCub, str name, str part, double sigma, unsigned int n_pop, double degr_per_neuron=0.0, str ini_path="../data/"):
+    def init(self, ANNiCub_wrapper iCub, str name, str part, double sigma, unsigned int n_pop, double degr_per_neuron=0.0, str ini_path="../data/", str carrier="", str coding="gaussian"):
         """Initialize the joint reader with given parameters.
 
         Parameters
@@ -136,6 +137,10 @@ cdef class PyJointReader:
             if set: population size depends on joint working range. (Default value = 0.0)
         ini_path : str
             Path to the "interface_param.ini"-file. (Default value = "../data/")
+        carrier : str
+            YARP carrier for the robot connections, e.g. tcp, fast_tcp, shmem, udp; empty: carrier option of the ini file. (Default value = "")
+        coding : str
+            population coding of the joint angles: gaussian, von_mises (wrap-around joints, period 360 degree) or thermometer. (Default value = "gaussian")
 
         Returns
         -------
@@ -145,7 +150,7 @@ cdef class PyJointReader:
         self._part = part
         # preregister module for some prechecks e.g. part already in use
         if self._register(name, iCub):
-            retval = deref(self._cpp_joint_reader).Init(part.encode('UTF-8'), sigma, n_pop, degr_per_neuron, ini_path.encode('UTF-8'))
+            retval = deref(self._cpp_joint_reader).Init(part.encode('UTF-8'), sigma, n_pop, degr_per_neuron, ini_path.encode('UTF-8'), carrier.encode('UTF-8'), coding.encode('UTF-8'))
             if not retval:
                 self._unregister(iCub)
             return retval
@@ -154,7 +159,7 @@ cdef class PyJointReader:
 
     # Initialize the joint reader with given parameters for use with gRPC
     def init_grpc(self, ANNiCub_wrapper iCub, str name, str part, double sigma, unsigned int n_pop, double degr_per_neuron=0.0, str ini_path="../data/",
-                  str ip_address="0.0.0.0", unsigned int port=50005):
+                  str ip_address="0.0.0.0", unsigned int port=50005, str carrier="", str coding="gaussian"):
         """Initialize the joint reader with given parameters, including the gRPC based connection.
 
         Parameters
@@ -178,6 +183,10 @@ cdef class PyJointReader:
             gRPC server ip address. (Default value = "0.0.0.0")
         port : unsigned int
             gRPC server port. (Default value = 50005)
+        carrier : str
+            YARP carrier for the robot connections, e.g. tcp, fast_tcp, shmem, udp; empty: carrier option of the ini file. (Default value = "")
+        coding : str
+            population coding of the joint angles: gaussian, von_mises (wrap-around joints, period 360 degree) or thermometer. (Default value = "gaussian")
 
         Returns
         -------
@@ -187,7 +196,7 @@ cdef class PyJointReader:
         self._part = part
         # preregister module for some prechecks e.g. part already in use
         if self._register(name, iCub):
-            retval = deref(self._cpp_joint_reader).InitGRPC(part.encode('UTF-8'), sigma, n_pop, degr_per_neuron, ini_path.encode('UTF-8'), ip_address.encode('UTF-8'), port)
+            retval = deref(self._cpp_joint_reader).InitGRPC(part.encode('UTF-8'), sigma, n_pop, degr_per_neuron, ini_path.encode('UTF-8'), ip_address.encode('UTF-8'), port, carrier.encode('UTF-8'), coding.encode('UTF-8'))
             if not retval:
                 self._unregister(iCub)
             return retval
@@ -216,6 +225,227 @@ cdef class PyJointReader:
         self._part = ""
         deref(self._cpp_joint_reader).Close()
 
+    # select the sampling mode
+    def set_sampling_mode(self, bint threaded, double rate=1000.0):
+        """Select the sampling mode. In threaded mode a sampler thread polls the joint encoders with the given rate and all read calls
+           return the newest sample at once, without a request to the robot; the timestamps of the timed reads are the sample times.
+
+        Parameters
+        ----------
+        threaded : bool
+            True for the background sampling; False to request the joint angles from the robot with every read call
+        rate : double
+            sampling rate in Hz of the background sampling. (Default value = 1000.0)
+
+        Returns
+        -------
+        bool
+            return True/False, indicating success/failure
+        """
+        return deref(self._cpp_joint_reader).SetSamplingMode(threaded, rate)
+
+    # select the streaming mode
+    def set_streaming_mode(self, bint streaming):
+        """Select the streaming mode. In streaming mode the reader subscribes to the joint state stream of the control board (stateExt:o);
+           all read calls return the newest received state without a request to the robot and the timed reads return the message timestamps.
+
+        Parameters
+        ----------
+        streaming : bool
+            True to receive the joint state stream; False to read the joints through the control board device
+
+        Returns
+        -------
+        bool
+            return True/False, indicating success/failure
+        """
+        return deref(self._cpp_joint_reader).SetStreamingMode(streaming)
+
+    # return the newest joint state of the state stream
+    def read_state_all(self):
+        """Read the joint state of all joints: joint angles, velocities and accelerations from one request, or the newest sample in the sampling/streaming mode.
+
+        Parameters
+        ----------
+
+        Returns
+        -------
+        tuple
+            (timestamp, positions, velocities, accelerations): newest robot-side timestamp of the joints in seconds and NDarrays with the joint angles in degree,
+            the joint velocities in degree/s and the joint accelerations in degree/s^2; None, if the state is not available
+        """
+        cdef double[::1] pos_view
+        cdef double[::1] vel_view
+        cdef double[::1] acc_view
+        cdef double timestamp = 0.
+
+        joints = self.get_joint_count()
+        if joints == 0:
+            return None
+        positions = np.zeros(joints, dtype=np.float64)
+        velocities = np.zeros(joints, dtype=np.float64)
+        accelerations = np.zeros(joints, dtype=np.float64)
+        pos_view = positions
+        vel_view = velocities
+        acc_view = accelerations
+        if not deref(self._cpp_joint_reader).ReadStateAll(&pos_view[0], &vel_view[0], &acc_view[0], &timestamp):
+            return None
+        return timestamp, positions, velocities, accelerations
+
+    # return a new array fitting the joint state
+    def create_state_buffer(self):
+        """Return a new array fitting the joint state of all joints. Can be used as reusable buffer with read_state_all_into.
+
+        Parameters
+        ----------
+
+        Returns
+        -------
+        NDarray
+            zero initialized float64 array with the shape (4, joints)
+        """
+        return np.zeros((4, self.get_joint_count()), dtype=np.float64)
+
+    # read the joint state of all joints into a preallocated array
+    def read_state_all_into(self, out):
+        """Read the joint state of all joints into a preallocated array, without memory allocation. The rows are the robot-side timestamps of the joints
+           in seconds, the joint angles in degree, the joint velocities in degree/s and the joint accelerations in degree/s^2; in the sampling/streaming
+           mode all joints carry the sample timestamp.
+
+        Parameters
+        ----------
+        out : NDarray
+            C-contiguous float64 array with the shape (4, joints), e.g. the array returned by create_state_buffer
+
+        Returns
+        -------
+        bool
+            return True/False, indicating success/failure
+        """
+        cdef double[::1] state
+
+        if out.dtype != np.float64 or not out.flags['C_CONTIGUOUS']:
+            print("[Interface iCub] Joint Reader buffer has to be C-contiguous with dtype float64!")
+            return False
+        if out.size == 0:
+            return False
+
+        state = out.reshape(-1)
+        return deref(self._cpp_joint_reader).ReadStateAllInto(&state[0], out.size)
+
+    # keep the history of the joint angles in a ring buffer
+    def set_history(self, unsigned int length, double rate=1000.0):
+        """Keep the history of the joint angles in a preallocated ring buffer, filled by the sampler thread; enables the sampling mode with the given rate.
+           Switching the sampling mode off stops the recording, the recorded samples stay readable.
+
+        Parameters
+        ----------
+        length : unsigned int
+            number of samples in the history; 0 -> no history (the sampling mode stays as it is)
+        rate : double
+            sampling rate in Hz of the history. (Default value = 1000.0)
+
+        Returns
+        -------
+        bool
+            return True/False, indicating success/failure
+        """
+        return deref(self._cpp_joint_reader).SetHistory(length, rate)
+
+    # get the number of samples in the history
+    def get_history_length(self):
+        """Return the number of samples in the history.
+
+        Parameters
+        ----------
+
+        Returns
+        -------
+        int
+            number of samples; 0 if no history is recorded
+        """
+        return deref(self._cpp_joint_reader).GetHistoryLength()
+
+    # create reusable buffers for the history readings
+    def create_history_buffers(self):
+        """Return new arrays fitting the whole history. Can be used as reusable buffers with read_history_last_into and read_history_since_into.
+
+        Parameters
+        ----------
+
+        Returns
+        -------
+        tuple
+            (values, timestamps): zero initialized float64 arrays with the shapes (history length, joints) and (history length,)
+        """
+        length = self.get_history_length()
+        return np.zeros((length, self.get_joint_count()), dtype=np.float64), np.zeros(length, dtype=np.float64)
+
+    # copy the last n samples of the history into preallocated arrays
+    def read_history_last_into(self, unsigned int n, out, timestamps):
+        """Copy the last n samples of the history into preallocated arrays, oldest sample first, without memory allocation.
+
+        Parameters
+        ----------
+        n : unsigned int
+            number of samples; n <= history length
+        out : NDarray
+            C-contiguous float64 array with at least n rows of joint angles, e.g. the values array returned by create_history_buffers
+        timestamps : NDarray
+            C-contiguous float64 array with at least n elements for the sample timestamps in seconds, e.g. the timestamps array returned by create_history_buffers
+
+        Returns
+        -------
+        int
+            number of copied samples -> valid rows out[:count]; -1 at error
+        """
+        cdef double[::1] values
+        cdef double[::1] stamps
+
+        if not self._check_history_buffers(out, timestamps, n):
+            return -1
+
+        values = out.reshape(-1)
+        stamps = timestamps.reshape(-1)
+        return deref(self._cpp_joint_reader).ReadHistoryLastInto(n, &values[0], &stamps[0], out.size)
+
+    # copy the samples of the history newer than the given time into preallocated arrays
+    def read_history_since_into(self, double since, out, timestamps):
+        """Copy the samples of the history newer than the given time into preallocated arrays, oldest sample first, without memory allocation.
+
+        Parameters
+        ----------
+        since : double
+            time limit in seconds (clock of the sample timestamps); samples with a timestamp > since are copied
+        out : NDarray
+            C-contiguous float64 array with history length rows of joint angles, e.g. the values array returned by create_history_buffers
+        timestamps : NDarray
+            C-contiguous float64 array with history length elements for the sample timestamps in seconds, e.g. the timestamps array returned by create_history_buffers
+
+        Returns
+        -------
+        int
+            number of copied samples -> valid rows out[:count]; -1 at error
+        """
+        cdef double[::1] values
+        cdef double[::1] stamps
+
+        if not self._check_history_buffers(out, timestamps, self.get_history_length()):
+            return -1
+
+        values = out.reshape(-1)
+        stamps = timestamps.reshape(-1)
+        return deref(self._cpp_joint_reader).ReadHistorySinceInto(since, &values[0], &stamps[0], out.size)
+
+    def _check_history_buffers(self, out, timestamps, rows):
+        if out.dtype != np.float64 or not out.flags['C_CONTIGUOUS'] or timestamps.dtype != np.float64 or not timestamps.flags['C_CONTIGUOUS']:
+            print("[Interface iCub] Joint Reader buffer has to be C-contiguous with dtype float64!")
+            return False
+        if out.size == 0 or timestamps.size < rows:
+            print("[Interface iCub] Joint Reader history buffers are too small!")
+            return False
+        return True
+
     # get the number of controlled joints
     def get_joint_count(self):
         """Return the number of controlled joints
@@ -258,6 +488,20 @@ cdef class PyJointReader:
         """
         return np.array(deref(self._cpp_joint_reader).GetNeuronsPerJoint())
 
+    # return the size of the largest population
+    def get_max_neurons_per_joint(self):
+        """Return the size of the largest population encoding a joint angle -> row length of the population buffer
+
+        Parameters
+        ----------
+
+        Returns
+        -------
+        int
+            maximum number of neurons per joint
+        """
+        return deref(self._cpp_joint_reader).GetMaxNeuronsPerJoint()
+
     # read all joints and return joint angles directly as double values
     def read_double_all(self):
         """Read all joints and return joint angles directly as double values
@@ -318,6 +562,296 @@ cdef class PyJointReader:
         """
         return np.array(deref(self._cpp_joint_reader).ReadPopAll())
 
+    # return a new array fitting the population code of all joints
+    def create_pop_buffer(self):
+        """Return a new array fitting the population code of all joints. Can be used as reusable buffer with read_pop_all_into.
+
+        Parameters
+        ----------
+
+        Returns
+        -------
+        NDarray
+            zero initialized float64 array with the shape (joints, max. neurons per joint)
+        """
+        return np.zeros((self.get_joint_count(), self.get_max_neurons_per_joint()), dtype=np.float64)
+
+    # read all joints and write the joint angles encoded in populations into a preallocated array
+    def read_pop_all_into(self, out):
+        """Read all joints and write the joint angles encoded in populations into a preallocated array, without memory allocation.
+           The rows of joints with smaller populations are zero padded.
+
+        Parameters
+        ----------
+        out : NDarray
+            C-contiguous float64 array with the shape (joints, max. neurons per joint), e.g. the array returned by create_pop_buffer
+
+        Returns
+        -------
+        bool
+            return True/False, indicating success/failure
+        """
+        cdef double[::1] pop
+
+        if out.dtype != np.float64 or not out.flags['C_CONTIGUOUS']:
+            print("[Interface iCub] Joint Reader buffer has to be C-contiguous with dtype float64!")
+            return False
+        if out.size == 0:
+            return False
+
+        pop = out.reshape(-1)
+        return deref(self._cpp_joint_reader).ReadPopAllInto(&pop[0], out.size)
+
+    # create a reusable buffer for read_pop_all_spikes_into
+    def create_spike_buffer(self):
+        """Return a new array fitting the spike indices of all joint populations. Can be used as reusable buffer with read_pop_all_spikes_into.
+
+        Parameters
+        ----------
+
+        Returns
+        -------
+        NDarray
+            int32 array with joints x max. neurons per joint elements
+        """
+        return np.zeros(self.get_joint_count() * self.get_max_neurons_per_joint(), dtype=np.int32)
+
+    # read all joints and draw one time step of Poisson spike trains into a preallocated array
+    def read_pop_all_spikes_into(self, out, double max_rate, double dt):
+        """Read all joints and draw one time step of Poisson spike trains from the population code, without memory allocation.
+           Neuron i spikes with the probability rate_i * max_rate * dt, with the population code value rate_i in [0, 1].
+
+        Parameters
+        ----------
+        out : NDarray
+            C-contiguous int32 array with joints x max. neurons per joint elements, e.g. the array returned by create_spike_buffer
+        max_rate : double
+            firing rate in Hz of a neuron with the population code value 1
+        dt : double
+            length of the time step in seconds
+
+        Returns
+        -------
+        int
+            number of spiking neurons -> out[:count] holds the indices in the (joints, max. neurons per joint) population array in ascending order; -1 at error
+        """
+        cdef int[::1] indices
+
+        if out.dtype != np.int32 or not out.flags['C_CONTIGUOUS']:
+            print("[Interface iCub] Joint Reader spike buffer has to be C-contiguous with dtype int32!")
+            return -1
+        if out.size == 0:
+            return -1
+
+        indices = out.reshape(-1)
+        return deref(self._cpp_joint_reader).ReadPopAllSpikesInto(&indices[0], out.size, max_rate, dt)
+
+    # read all joints and draw one time step of Poisson spike trains
+    def read_pop_all_spikes(self, double max_rate, double dt):
+        """Read all joints and draw one time step of Poisson spike trains from the population code.
+
+        Parameters
+        ----------
+        max_rate : double
+            firing rate in Hz of a neuron with the population code value 1
+        dt : double
+            length of the time step in seconds
+
+        Returns
+        -------
+        NDarray
+            int32 indices of the spiking neurons in the (joints, max. neurons per joint) population array; empty array at error
+        """
+        out = self.create_spike_buffer()
+        count = self.read_pop_all_spikes_into(out, max_rate, dt)
+        return out[:max(count, 0)].copy()
+
+    # restrict the population coding to a window around the joint angle
+    def set_sparse_cutoff(self, double cutoff):
+        """Restrict the population coding to the neurons within cutoff * sigma of the joint angle. The other neurons are set to zero
+           without evaluation; this also applies to the dense readings. Only available for the Gaussian coding.
+
+        Parameters
+        ----------
+        cutoff : double
+            half width of the encoding window in multiples of sigma; 0 restores the default window of 8 sigma
+
+        Returns
+        -------
+        bool
+            return True/False, indicating success/failure
+        """
+        return deref(self._cpp_joint_reader).SetSparseCutoff(cutoff)
+
+    # return the maximum number of neurons within the encoding window
+    def get_sparse_width(self):
+        """Return the maximum number of neurons within the encoding window -> row length of the sparse value buffer
+
+        Parameters
+        ----------
+
+        Returns
+        -------
+        int
+            maximum number of encoded neurons per joint
+        """
+        return deref(self._cpp_joint_reader).GetSparseWidth()
+
+    # return new arrays fitting the sparse population code
+    def create_sparse_buffers(self):
+        """Return new arrays fitting the sparse population code of all joints. Can be used as reusable buffers with read_pop_all_sparse_into.
+
+        Parameters
+        ----------
+
+        Returns
+        -------
+        tuple
+            (start, count, values): int32 arrays with the shape (joints,) and a zero initialized float64 array with the shape (joints, sparse width)
+        """
+        joints = self.get_joint_count()
+        return (np.zeros(joints, dtype=np.int32), np.zeros(joints, dtype=np.int32),
+                np.zeros((joints, self.get_sparse_width()), dtype=np.float64))
+
+    # read all joints and write the sparse population code into preallocated arrays
+    def read_pop_all_sparse_into(self, start, count, values):
+        """Read all joints and write the sparse population code into preallocated arrays, without memory allocation.
+           Row j of values holds count[j] values for the neurons start[j] ... start[j] + count[j] - 1 of the joint population.
+
+        Parameters
+        ----------
+        start : NDarray
+            C-contiguous int32 array with the shape (joints,) for the index of the first encoded neuron
+        count : NDarray
+            C-contiguous int32 array with the shape (joints,) for the number of encoded neurons
+        values : NDarray
+            C-contiguous float64 array with the shape (joints, sparse width), e.g. the arrays returned by create_sparse_buffers
+
+        Returns
+        -------
+        bool
+            return True/False, indicating success/failure
+        """
+        cdef int[::1] start_view
+        cdef int[::1] count_view
+        cdef double[::1] values_view
+
+        joints = self.get_joint_count()
+        if start.dtype != np.int32 or count.dtype != np.int32 or not start.flags['C_CONTIGUOUS'] or not count.flags['C_CONTIGUOUS']:
+            print("[Interface iCub] Joint Reader start/count buffers have to be C-contiguous with dtype int32!")
+            return False
+        if start.size != joints or count.size != joints:
+            print("[Interface iCub] Joint Reader start/count buffers need one element per joint!")
+            return False
+        if values.dtype != np.float64 or not values.flags['C_CONTIGUOUS']:
+            print("[Interface iCub] Joint Reader value buffer has to be C-contiguous with dtype float64!")
+            return False
+        if joints == 0 or values.size == 0:
+            return False
+
+        start_view = start.reshape(-1)
+        count_view = count.reshape(-1)
+        values_view = values.reshape(-1)
+        return deref(self._cpp_joint_reader).ReadPopAllSparseInto(&start_view[0], &count_view[0], &values_view[0], values.size)
+
+    # read all joints and return the sparse population code
+    def read_pop_all_sparse(self):
+        """Read all joints and return the sparse population code.
+
+        Parameters
+        ----------
+
+        Returns
+        -------
+        list
+            one tuple (start, values) per joint: index of the first encoded neuron and the values of the encoding window (NDarray)
+        """
+        start, count, values = self.create_sparse_buffers()
+        if not self.read_pop_all_sparse_into(start, count, values):
+            return []
+        return [(int(start[j]), values[j, :count[j]].copy()) for j in range(start.size)]
+
+    # set the deadbands of the change detection
+    def set_deadband(self, deadband, bint cache_pop=False):
+        """Set the deadbands of the joints for the change detection: a joint counts as changed, if its angle moved more than its deadband since it was
+           last reported as changed to the same consumer (read_changed_mask, every changed-only gRPC client); the other readings do not consume changes.
+           With the population cache, the population readings of all joints return the cached population of the last held angle for joints within
+           their deadband instead of encoding the new angle.
+
+        Parameters
+        ----------
+        deadband : double | list
+            deadband in degree; one value for all joints or one value per joint; empty list -> no deadband, every movement counts
+        cache_pop : bool
+            reuse the cached population of unchanged joints. (Default value = False)
+
+        Returns
+        -------
+        bool
+            return True/False, indicating success/failure
+        """
+        if np.isscalar(deadband):
+            deadband = [deadband]
+        return deref(self._cpp_joint_reader).SetDeadband(np.asarray(deadband, dtype=np.float64).tolist(), cache_pop)
+
+    # get the deadbands of the change detection
+    def get_deadband(self):
+        """Return the deadbands of the joints.
+
+        Parameters
+        ----------
+
+        Returns
+        -------
+        NDarray
+            deadband in degree per joint
+        """
+        return np.array(deref(self._cpp_joint_reader).GetDeadband())
+
+    # read all joints and write the changed mask into a preallocated array
+    def read_changed_mask_into(self, out):
+        """Read all joints and write the changed mask into a preallocated array, without memory allocation: the joints, which moved beyond
+           their deadband since the last call of read_changed_mask/read_changed_mask_into. Independent of the other readings.
+
+        Parameters
+        ----------
+        out : NDarray
+            C-contiguous bool or uint8 array with one element per joint
+
+        Returns
+        -------
+        int
+            number of changed joints; -1 at error
+        """
+        cdef uint8_t[::1] mask
+
+        if (out.dtype != np.bool_ and out.dtype != np.uint8) or not out.flags['C_CONTIGUOUS']:
+            print("[Interface iCub] Joint Reader changed mask has to be C-contiguous with dtype bool or uint8!")
+            return -1
+        if out.size == 0:
+            return -1
+
+        mask = out.reshape(-1).view(np.uint8)
+        return deref(self._cpp_joint_reader).ReadChangedMaskInto(&mask[0], out.size)
+
+    # read all joints and return the changed mask
+    def read_changed_mask(self):
+        """Read all joints and return the changed mask: True for the joints, which moved beyond their deadband since the last call of
+           read_changed_mask/read_changed_mask_into. Independent of the other readings.
+
+        Parameters
+        ----------
+
+        Returns
+        -------
+        NDarray
+            bool array with one element per joint; empty array at error
+        """
+        out = np.zeros(self.get_joint_count(), dtype=np.bool_)
+        if self.read_changed_mask_into(out) < 0:
+            return np.zeros(0, dtype=np.bool_)
+        return out
+
     # read multiple joints and return the joint angles encoded in a vector (population coding)
     def read_pop_multiple(self, joints):
         """Read multiple joints and return the joint angles encoded in vectors (population coding).
@@ -349,3 +883,234 @@ cdef class PyJointReader:
             population vector encoding the joint angle
         """
         return np.array(deref(self._cpp_joint_reader).ReadPopOne(joint))
+
+
+cdef class PyMultiJointReader(PyModuleBase):
+    """Wrapper class for the multi-part Joint Reader: reads several robot parts concurrently into one contiguous output.
+       The module is not registered at the main wrapper -> not included in save_robot_to_file."""
+
+    # init method
+    def __cinit__(self):
+        print("Initialize iCub Interface: Multi Joint Reader.")
+        self._cpp_multi_joint_reader = make_shared[MultiJointReader]()
+
+    # close method
+    def __dealloc__(self):
+        print("Close iCub Interface: Multi Joint Reader.")
+        self._cpp_multi_joint_reader.reset()
+
+    '''
+    # Access to multi joint reader member functions
+    '''
+
+    # Initialize the multi joint reader with given parameters
+    def init(self, list parts, double sigma, unsigned int n_pop, double degr_per_neuron=0.0, str ini_path="../data/", str carrier="", str coding="gaussian"):
+        """Initialize the multi-part joint reader with given parameters. Every part gets its own control board connection.
+
+        Parameters
+        ----------
+        parts : list
+            robot parts in the output order, have to match iCub part naming {left_(arm/leg), right_(arm/leg), head, torso}
+        sigma : double
+            sigma for the joints angles populations coding
+        n_pop : unsigned int
+            number of neurons per population, encoding each one joint angle only works if parameter "deg_per_neuron" is not set
+        degr_per_neuron : double
+            degree per neuron in the populations, encoding the joints angles
+            if set: population size depends on joint working range. (Default value = 0.0)
+        ini_path : str
+            Path to the "interface_param.ini"-file. (Default value = "../data/")
+        carrier : str
+            YARP carrier for the robot connections, e.g. tcp, fast_tcp, shmem, udp; empty: carrier option of the ini file. (Default value = "")
+        coding : str
+            population coding of the joint angles: gaussian, von_mises (wrap-around joints, period 360 degree) or thermometer. (Default value = "gaussian")
+
+        Returns
+        -------
+        bool
+            return True, if successful
+        """
+        self._part = ",".join(parts)
+        return deref(self._cpp_multi_joint_reader).Init([part.encode('UTF-8') for part in parts], sigma, n_pop, degr_per_neuron, ini_path.encode('UTF-8'), carrier.encode('UTF-8'), coding.encode('UTF-8'))
+
+    # close the module
+    def close(self):
+        """Close multi-part joint reader with cleanup
+
+        Parameters
+        ----------
+
+        Returns
+        -------
+
+        """
+        self._part = ""
+        deref(self._cpp_multi_joint_reader).Close()
+
+    # select the sampling mode of all parts
+    def set_sampling_mode(self, bint threaded, double rate=1000.0):
+        """Select the sampling mode of all parts (see PyJointReader.set_sampling_mode).
+
+        Parameters
+        ----------
+        threaded : bool
+            True for the background sampling; False to request the joint angles from the robot with every read call
+        rate : double
+            sampling rate in Hz of the background sampling. (Default value = 1000.0)
+
+        Returns
+        -------
+        bool
+            return True/False, indicating success/failure
+        """
+        return deref(self._cpp_multi_joint_reader).SetSamplingMode(threaded, rate)
+
+    # get the robot parts
+    def get_parts(self):
+        """Return the robot parts in the output order.
+
+        Parameters
+        ----------
+
+        Returns
+        -------
+        list
+            robot part names
+        """
+        return [part.decode('UTF-8') for part in deref(self._cpp_multi_joint_reader).GetParts()]
+
+    # get the number of joints of all parts
+    def get_joint_count(self):
+        """Return the number of joints of all parts.
+
+        Parameters
+        ----------
+
+        Returns
+        -------
+        int
+            number of joints
+        """
+        return deref(self._cpp_multi_joint_reader).GetJointCount()
+
+    # get the offset table of the parts
+    def get_joint_offsets(self):
+        """Return the offset table of the parts: the joints of a part are the entries first to end - 1 of the output.
+
+        Parameters
+        ----------
+
+        Returns
+        -------
+        dict
+            part name -> (first index, end index) in the output
+        """
+        offsets = deref(self._cpp_multi_joint_reader).GetJointOffsets()
+        return {part: (offsets[i], offsets[i + 1]) for i, part in enumerate(self.get_parts())}
+
+    # get the size of the largest population
+    def get_max_neurons_per_joint(self):
+        """Return the size of the largest joint population of all parts -> row length of the population buffer
+
+        Parameters
+        ----------
+
+        Returns
+        -------
+        int
+            number of neurons of the largest population
+        """
+        return deref(self._cpp_multi_joint_reader).GetMaxNeuronsPerJoint()
+
+    # create a reusable buffer for read_double_all_into
+    def create_double_buffer(self):
+        """Return a new array fitting the joint angles of all parts. Can be used as reusable buffer with read_double_all_into.
+
+        Parameters
+        ----------
+
+        Returns
+        -------
+        NDarray
+            zero initialized float64 array with the shape (joints,)
+        """
+        return np.zeros(self.get_joint_count(), dtype=np.float64)
+
+    # create a reusable buffer for read_pop_all_into
+    def create_pop_buffer(self):
+        """Return a new array fitting the population code of all parts. Can be used as reusable buffer with read_pop_all_into.
+
+        Parameters
+        ----------
+
+        Returns
+        -------
+        NDarray
+            zero initialized float64 array with the shape (joints, max. neurons per joint)
+        """
+        return np.zeros((self.get_joint_count(), self.get_max_neurons_per_joint()), dtype=np.float64)
+
+    # read all joints of all parts and return joint angles directly as double values
+    def read_double_all(self):
+        """Read all joints of all parts and return joint angles directly as double values; the parts are read concurrently.
+
+        Parameters
+        ----------
+
+        Returns
+        -------
+        NDarray : vector[double]
+            joint angles read from the robot in the order of the offset table; empty vector at error
+        """
+        return np.array(deref(self._cpp_multi_joint_reader).ReadDoubleAll(), dtype=np.float64)
+
+    # read all joints of all parts and write the joint angles into a preallocated array
+    def read_double_all_into(self, out):
+        """Read all joints of all parts and write the joint angles into a preallocated array, without memory allocation.
+
+        Parameters
+        ----------
+        out : NDarray
+            C-contiguous float64 array with the shape (joints,), e.g. the array returned by create_double_buffer
+
+        Returns
+        -------
+        bool
+            return True/False, indicating success/failure
+        """
+        cdef double[::1] angles
+
+        if out.dtype != np.float64 or not out.flags['C_CONTIGUOUS']:
+            print("[Interface iCub] Multi Joint Reader buffer has to be C-contiguous with dtype float64!")
+            return False
+        if out.size == 0:
+            return False
+
+        angles = out.reshape(-1)
+        return deref(self._cpp_multi_joint_reader).ReadDoubleAllInto(&angles[0], out.size)
+
+    # read all joints of all parts and write the joint angles encoded in populations into a preallocated array
+    def read_pop_all_into(self, out):
+        """Read all joints of all parts and write the joint angles encoded in populations into a preallocated array, without memory allocation.
+           The rows of joints with smaller populations are zero padded.
+
+        Parameters
+        ----------
+        out : NDarray
+            C-contiguous float64 array with the shape (joints, max. neurons per joint), e.g. the array returned by create_pop_buffer
+
+        Returns
+        -------
+        bool
+            return True/False, indicating success/failure
+        """
+        cdef double[::1] pop
+
+        if out.dtype != np.float64 or not out.flags['C_CONTIGUOUS']:
+            print("[Interface iCub] Multi Joint Reader buffer has to be C-contiguous with dtype float64!")
+            return False
+        if out.size == 0:
+            return False
+
+        pop = out.reshape(-1)
+        return deref(self._cpp_multi_joint_reader).ReadPopAllInto(&pop[0], out.size)
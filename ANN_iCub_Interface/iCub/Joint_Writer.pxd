@@ -37,10 +37,10 @@ cdef extern from "Joint_Writer.hpp":
         JointWriter() except +
 
         # Initialize the joint writer with given parameters
-        bool_t Init(string, unsigned int, double, double, string)
+        bool_t Init(string, unsigned int, double, double, string, string)
 
         # Initialize the joint writer with given parameters for use with gRPC
-        bool_t InitGRPC(string, unsigned int, vector[int], string, bool_t, double, double, string, string, unsigned int)
+        bool_t InitGRPC(string, unsigned int, vector[int], string, bool_t, double, double, string, string, unsigned int, string)
 
         # Close joint writer with cleanup
         void Close()
@@ -90,6 +90,12 @@ cdef extern from "Joint_Writer.hpp":
         # Write one joint with the joint angle encoded in a population.
         bool_t WritePopOne(vector[double], int, string, bool_t, long)
 
+        # Write all joints with the joint angles encoded in populations, given as one contiguous array (joints x row size).
+        bool_t WritePopAllArray(const double*, size_t, unsigned int, string, bool_t, long)
+
+        # Write multiple joints with the joint angles encoded in populations, given as one contiguous array (joints x row size).
+        bool_t WritePopMultipleArray(const double*, size_t, unsigned int, vector[int], string, bool_t, long)
+
         # void setRegister(bint)
         # bint getRegister()
 
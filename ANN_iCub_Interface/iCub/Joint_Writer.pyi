@@ -99,7 +99,7 @@ class PyJointWriter:
         """
         ...
 
-    def init(self, iCub: ANNiCub_wrapper, name: str, part: str, n_pop: int, degr_per_neuron: float = ..., speed: float = ..., ini_path: str = ...) -> bool:
+    def init(self, iCub: ANNiCub_wrapper, name: str, part: str, n_pop: int, degr_per_neuron: float = ..., speed: float = ..., ini_path: str = ..., carrier: str = ...) -> bool:
         """Initialize the joint writer with given parameters.
 
         Parameters
@@ -120,6 +120,8 @@ class PyJointWriter:
             velocity for the joint movements. (Default value = 10.0)
         ini_path : str
             Path to the "interface_param.ini"-file. (Default value = "../data/")
+        carrier : str
+            YARP carrier for the robot connections, e.g. tcp, fast_tcp, shmem, udp; empty: carrier option of the ini file. (Default value = "")
 
         Returns
         -------
@@ -129,7 +131,7 @@ class PyJointWriter:
         ...
 
     def init_grpc(self, iCub: ANNiCub_wrapper, name: str, part: str, n_pop: int, joints, mode: str, blocking=..., degr_per_neuron: float = ..., speed: float = ...,
-                  ini_path: str = ..., ip_address: str = ..., port: int = ...) -> bool:
+                  ini_path: str = ..., ip_address: str = ..., port: int = ..., carrier: str = ...) -> bool:
         """Initialize the joint writer with given parameters, including the gRPC based connection.
 
         Parameters
@@ -163,6 +165,8 @@ class PyJointWriter:
             gRPC server ip address. (Default value = "0.0.0.0")
         port : unsigned int
             gRPC server port. (Default value = 50010)
+        carrier : str
+            YARP carrier for the robot connections, e.g. tcp, fast_tcp, shmem, udp; empty: carrier option of the ini file. (Default value = "")
 
         Returns
         -------
@@ -352,7 +356,8 @@ class PyJointWriter:
         Parameters
         ----------
         position_pops : NDarray (vector[vector[double]]
-            vector of populations, each encoding the angle/velocity for a single joint
+            vector of populations, each encoding the angle/velocity for a single joint; a 2D NDarray (joints x neurons) is decoded
+            directly from the array memory (no copy for C-contiguous float64). Populations without activity keep the joint at its position
         mode : str
             string to select the motion mode:
                 'abs' for absolute joint angle positions;
@@ -376,7 +381,8 @@ class PyJointWriter:
         Parameters
         ----------
         position_pops : NDarray (vector[vector[double]]
-            vector of populations, each encoding the angle/velocity for a single joint
+            vector of populations, each encoding the angle/velocity for a single joint; a 2D NDarray (joints x neurons) is decoded
+            directly from the array memory (no copy for C-contiguous float64). Populations without activity keep the joint at its position
         joints : list/NDarray (vector[int]
             Joint indizes of the joints, which should be moved (head: [3, 4, 5] -> all eye movements)
         mode : str
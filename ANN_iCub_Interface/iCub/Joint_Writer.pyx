@@ -116,7 +116,7 @@ cdef class PyJointWriter(PyModuleBase):
     '''
 
     # initialize the joint writer with given parameters
-    def init(self, iCub, str name, str part, unsigned int n_pop, double degr_per_neuron=0.0, double speed=10.0, str ini_path="../data/"):
+    def init(self, iCub, str name, str part, unsigned int n_pop, double degr_per_neuron=0.0, double speed=10.0, str ini_path="../data/", str carrier=""):
         """Initialize the joint writer with given parameters.
 
         Parameters
@@ -137,6 +137,8 @@ cdef class PyJointWriter(PyModuleBase):
             velocity for the joint movements. (Default value = 10.0)
         ini_path : str
             Path to the "interface_param.ini"-file. (Default value = "../data/")
+        carrier : str
+            YARP carrier for the robot connections, e.g. tcp, fast_tcp, shmem, udp; empty: carrier option of the ini file. (Default value = "")
 
         Returns
         -------
@@ -150,7 +152,7 @@ cdef class PyJointWriter(PyModuleBase):
         self._part = part
         # preregister module for some prechecks e.g. part already in use
         if self._register(name, iCub):
-            retval = deref(self._cpp_joint_writer).Init(key, n_pop, degr_per_neuron, speed, path)
+            retval = deref(self._cpp_joint_writer).Init(key, n_pop, degr_per_neuron, speed, path, carrier.encode('UTF-8'))
             if not retval:
                 self._unregister(iCub)
             return retval
@@ -159,7 +161,7 @@ cdef class PyJointWriter(PyModuleBase):
 
     # Initialize the joint writer with given parameters for use with gRPC
     def init_grpc(self, iCub, str name, str part, unsigned int n_pop, joints, str mode, blocking=True, double degr_per_neuron=0.0,
-                  double speed=10.0, str ini_path="../data/", str ip_address="0.0.0.0", unsigned int port=50010):
+                  double speed=10.0, str ini_path="../data/", str ip_address="0.0.0.0", unsigned int port=50010, str carrier=""):
         """Initialize the joint writer with given parameters, including the gRPC based connection.
 
         Parameters
@@ -193,6 +195,8 @@ cdef class PyJointWriter(PyModuleBase):
             gRPC server ip address. (Default value = "0.0.0.0")
         port : unsigned int
             gRPC server port. (Default value = 50010)
+        carrier : str
+            YARP carrier for the robot connections, e.g. tcp, fast_tcp, shmem, udp; empty: carrier option of the ini file. (Default value = "")
 
         Returns
         -------
@@ -203,7 +207,7 @@ cdef class PyJointWriter(PyModuleBase):
         # preregister module for some prechecks e.g. part already in use
         if self._register(name, iCub):
             retval = deref(self._cpp_joint_writer).InitGRPC(part.encode('UTF-8'), n_pop, joints, mode.encode('UTF-8'), blocking.__int__(), degr_per_neuron,
-                                                            speed, ini_path.encode('UTF-8'), ip_address.encode('UTF-8'), port)
+                                                            speed, ini_path.encode('UTF-8'), ip_address.encode('UTF-8'), port, carrier.encode('UTF-8'))
             if not retval:
                 self._unregister(iCub)
             return retval
@@ -459,7 +463,8 @@ cdef class PyJointWriter(PyModuleBase):
         Parameters
         ----------
         position_pops : NDarray (vector[vector[double]]
-            vector of populations, each encoding the angle/velocity for a single joint
+            vector of populations, each encoding the angle/velocity for a single joint; a 2D NDarray (joints x neurons) is decoded
+            directly from the array memory (no copy for C-contiguous float64). Populations without activity keep the joint at its position
         mode : str
             string to select the motion mode:
             - 'abs' for absolute joint angle positions
@@ -473,10 +478,15 @@ cdef class PyJointWriter(PyModuleBase):
         bool
             return True/False, indicating success/failure
         """
+        cdef double[:, ::1] pops
         # we need to transform py-string to c++ compatible string
         cdef string s1 = mode.encode('UTF-8')
         # we need to transform py-bool to c++ compatible boolean
         cdef bint block = blocking.__int__()
+        # 2D arrays are decoded from the array memory -> no conversion into nested vectors
+        if isinstance(position_pops, np.ndarray) and position_pops.ndim == 2 and position_pops.size > 0:
+            pops = np.ascontiguousarray(position_pops, dtype=np.float64)
+            return deref(self._cpp_joint_writer).WritePopAllArray(&pops[0, 0], pops.shape[0] * pops.shape[1], pops.shape[1], s1, block, timeout)
         return deref(self._cpp_joint_writer).WritePopAll(position_pops, s1, block, timeout)
 
     # write multiple joints with joint angles encoded in populations vectors
@@ -486,7 +496,8 @@ cdef class PyJointWriter(PyModuleBase):
         Parameters
         ----------
         position_pops : NDarray (vector[vector[double]]
-            vector of populations, each encoding the angle/velocity for a single joint
+            vector of populations, each encoding the angle/velocity for a single joint; a 2D NDarray (joints x neurons) is decoded
+            directly from the array memory (no copy for C-contiguous float64). Populations without activity keep the joint at its position
         joints : list/NDarray (vector[int]
             Joint indizes of the joints, which should be moved (head: [3, 4, 5] -> all eye movements)
         mode : str
@@ -502,10 +513,15 @@ cdef class PyJointWriter(PyModuleBase):
         bool
             return True/False, indicating success/failure
         """
+        cdef double[:, ::1] pops
         # we need to transform py-string to c++ compatible string
         cdef string s1 = mode.encode('UTF-8')
         # we need to transform py-bool to c++ compatible boolean
         cdef bint block = blocking.__int__()
+        # 2D arrays are decoded from the array memory -> no conversion into nested vectors
+        if isinstance(position_pops, np.ndarray) and position_pops.ndim == 2 and position_pops.size > 0:
+            pops = np.ascontiguousarray(position_pops, dtype=np.float64)
+            return deref(self._cpp_joint_writer).WritePopMultipleArray(&pops[0, 0], pops.shape[0] * pops.shape[1], pops.shape[1], joints, s1, block, timeout)
         return deref(self._cpp_joint_writer).WritePopMultiple(position_pops, joints, s1, block, timeout)
 
     # write one joint with the joint angle encoded in a population vector
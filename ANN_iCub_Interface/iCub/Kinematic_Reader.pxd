@@ -36,10 +36,10 @@ cdef extern from "Kinematic_Reader.hpp":
         KinematicReader() except +
 
         # Initialize the joint reader with given parameters
-        bool_t Init(string, float, string, bool_t)
+        bool_t Init(string, float, string, bool_t, string)
 
         # Initialize the joint reader with given parameters
-        bool_t InitGRPC(string, float, string, string, unsigned int, bool_t)
+        bool_t InitGRPC(string, float, string, string, unsigned int, bool_t, string)
 
         # Close joint reader with cleanup
         void Close()
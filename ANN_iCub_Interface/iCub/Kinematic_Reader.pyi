@@ -117,7 +117,7 @@ class PyKinematicReader:
         """
         ...
 
-    def init(self, iCub: ANNiCub_wrapper, name: str, part: str, version: float, ini_path: str = ..., offline_mode=...) -> bool:
+    def init(self, iCub: ANNiCub_wrapper, name: str, part: str, version: float, ini_path: str = ..., offline_mode=..., carrier: str = ...) -> bool:
         """Initialize the Kinematic Reader with given parameters
 
         Parameters
@@ -134,6 +134,8 @@ class PyKinematicReader:
             path to the interface ini-file. (Default value = "../data/")
         offline_mode : bool
             flag, if iCub network is offline. (Default value = False)
+        carrier : str
+            YARP carrier for the robot connections, e.g. tcp, fast_tcp, shmem, udp; empty: carrier option of the ini file. (Default value = "")
 
         Returns
         -------
@@ -143,7 +145,7 @@ class PyKinematicReader:
         ...
 
     def init_grpc(self, iCub: ANNiCub_wrapper, name: str, part: str, version: float, ini_path: str = ...,
-                  ip_address: str = ..., port: int = ..., offline_mode=...) -> bool:
+                  ip_address: str = ..., port: int = ..., offline_mode=..., carrier: str = ...) -> bool:
         """Initialize the Kinematic Reader with given parameters, including the gRPC based connection.
 
         Parameters
@@ -164,6 +166,8 @@ class PyKinematicReader:
             gRPC server port. (Default value = 50020)
         offline_mode : bool
             flag, if iCub network is offline. (Default value = False)
+        carrier : str
+            YARP carrier for the robot connections, e.g. tcp, fast_tcp, shmem, udp; empty: carrier option of the ini file. (Default value = "")
 
         Returns
         -------
@@ -107,7 +107,7 @@ cdef class PyKinematicReader:
     '''
 
     # Init Kinematic reader with given parameters
-    def init(self, ANNiCub_wrapper iCub, str name, str part, float version, str ini_path ="../data/", offline_mode=False):
+    def init(self, ANNiCub_wrapper iCub, str name, str part, float version, str ini_path ="../data/", offline_mode=False, str carrier=""):
         """Initialize the Kinematic Reader with given parameters
 
         Parameters
@@ -124,6 +124,8 @@ cdef class PyKinematicReader:
             path to the interface ini-file. (Default value = "../data/")
         offline_mode : bool
             flag, if iCub network is offline. (Default value = False)
+        carrier : str
+            YARP carrier for the robot connections, e.g. tcp, fast_tcp, shmem, udp; empty: carrier option of the ini file. (Default value = "")
 
         Returns
         -------
@@ -134,7 +136,7 @@ cdef class PyKinematicReader:
         # preregister module for some prechecks e.g. name already in use
         if self._register(name, iCub):
             # call the interface
-            retval = deref(self._cpp_kin_reader).Init(part.encode('UTF-8'), version, ini_path.encode('UTF-8'), offline_mode.__int__())
+            retval = deref(self._cpp_kin_reader).Init(part.encode('UTF-8'), version, ini_path.encode('UTF-8'), offline_mode.__int__(), carrier.encode('UTF-8'))
             if not retval:
                 self._unregister(iCub)
             return retval
@@ -143,7 +145,7 @@ cdef class PyKinematicReader:
 
     # Init Kinematic reader with given parameters, including the gRPC based connection
     def init_grpc(self, ANNiCub_wrapper iCub, str name, str part, float version, str ini_path ="../data/", str ip_address="0.0.0.0",
-                  unsigned int port=50020, offline_mode=False):
+                  unsigned int port=50020, offline_mode=False, str carrier=""):
         """Initialize the Kinematic Reader with given parameters, including the gRPC based connection.
 
         Parameters
@@ -164,6 +166,8 @@ cdef class PyKinematicReader:
             gRPC server port. (Default value = 50020)
         offline_mode : bool
             flag, if iCub network is offline. (Default value = False)
+        carrier : str
+            YARP carrier for the robot connections, e.g. tcp, fast_tcp, shmem, udp; empty: carrier option of the ini file. (Default value = "")
 
         Returns
         -------
@@ -174,7 +178,7 @@ cdef class PyKinematicReader:
         # preregister module for some prechecks e.g. eye already in use
         if self._register(name, iCub):
             # call the interface
-            retval = deref(self._cpp_kin_reader).InitGRPC(part.encode('UTF-8'), version, ini_path.encode('UTF-8'), ip_address.encode('UTF-8'), port, offline_mode.__int__())
+            retval = deref(self._cpp_kin_reader).InitGRPC(part.encode('UTF-8'), version, ini_path.encode('UTF-8'), ip_address.encode('UTF-8'), port, offline_mode.__int__(), carrier.encode('UTF-8'))
             if not retval:
                 self._unregister(iCub)
             return retval
@@ -36,10 +36,10 @@ cdef extern from "Kinematic_Writer.hpp":
         KinematicWriter() except +
 
         # Initialize the joint writer with given parameters
-        bool_t Init(string, float, string, bool_t, bool_t)
+        bool_t Init(string, float, string, bool_t, bool_t, string)
 
         # Initialize the joint writer with given parameters
-        bool_t InitGRPC(string, float, string, string, unsigned int, bool_t, bool_t)
+        bool_t InitGRPC(string, float, string, string, unsigned int, bool_t, bool_t, string)
 
         # Close joint writer with cleanup
         void Close()
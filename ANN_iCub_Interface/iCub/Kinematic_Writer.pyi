@@ -90,7 +90,7 @@ class PyKinematicWriter:
         """
         ...
 
-    def init(self, iCub: ANNiCub_wrapper, name: str, part: str, version: float, ini_path: str = ..., offline_mode=...) -> bool:
+    def init(self, iCub: ANNiCub_wrapper, name: str, part: str, version: float, ini_path: str = ..., offline_mode=..., carrier: str = ...) -> bool:
         """Initialize the Kinematic Writer with given parameters.
 
         Parameters
@@ -107,6 +107,8 @@ class PyKinematicWriter:
             path to the interface ini-file. (Default value = "../data/")
         offline_mode : bool
             flag, if iCub network is offline. (Default value = False)
+        carrier : str
+            YARP carrier for the robot connections, e.g. tcp, fast_tcp, shmem, udp; empty: carrier option of the ini file. (Default value = "")
 
         Returns
         -------
@@ -115,7 +117,7 @@ class PyKinematicWriter:
         """
         ...
 
-    def init_grpc(self, iCub: ANNiCub_wrapper, name: str, part: str, version: float, ini_path: str = ..., ip_address: str = ..., port: int = ..., offline_mode=...) -> bool:
+    def init_grpc(self, iCub: ANNiCub_wrapper, name: str, part: str, version: float, ini_path: str = ..., ip_address: str = ..., port: int = ..., offline_mode=..., carrier: str = ...) -> bool:
         """Initialize the Kinematic Writer with given parameters, including the gRPC based connection.
 
         Parameters
@@ -136,6 +138,8 @@ class PyKinematicWriter:
             gRPC server port. (Default value = 50025)
         offline_mode : bool
             flag, if iCub network is offline. (Default value = False)
+        carrier : str
+            YARP carrier for the robot connections, e.g. tcp, fast_tcp, shmem, udp; empty: carrier option of the ini file. (Default value = "")
 
         Returns
         -------
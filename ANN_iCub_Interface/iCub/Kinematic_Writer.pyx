@@ -106,7 +106,7 @@ cdef class PyKinematicWriter(PyModuleBase):
     '''
 
     # init kinematic writer with given parameters
-    def init(self, iCub, str name, str part, float version, str ini_path = "../data/", offline_mode=False, active_torso=True):
+    def init(self, iCub, str name, str part, float version, str ini_path = "../data/", offline_mode=False, active_torso=True, str carrier=""):
         """Initialize the Kinematic Writer with given parameters.
 
         Parameters
@@ -121,6 +121,8 @@ cdef class PyKinematicWriter(PyModuleBase):
             version of the robot hardware
         ini_path : str
             path to the interface ini-file. (Default value = "../data/")
+        carrier : str
+            YARP carrier for the robot connections, e.g. tcp, fast_tcp, shmem, udp; empty: carrier option of the ini file. (Default value = "")
 
         Returns
         -------
@@ -130,7 +132,7 @@ cdef class PyKinematicWriter(PyModuleBase):
         self._part = part
         # preregister module for some prechecks e.g. name already in use
         if self._register(name, iCub):
-            retval = deref(self._cpp_kin_writer).Init(part.encode('UTF-8'), version, ini_path.encode('UTF-8'), offline_mode, active_torso)
+            retval = deref(self._cpp_kin_writer).Init(part.encode('UTF-8'), version, ini_path.encode('UTF-8'), offline_mode, active_torso, carrier.encode('UTF-8'))
             if not retval:
                 self._unregister(iCub)
             return retval
@@ -138,7 +140,7 @@ cdef class PyKinematicWriter(PyModuleBase):
             return False
 
     # init kinematic writer with given parameters, including the gRPC based connection
-    def init_grpc(self, iCub, str name, str part, float version, str ini_path = "../data/", str ip_address = "0.0.0.0", unsigned int port = 50025, offline_mode=False, active_torso=True):
+    def init_grpc(self, iCub, str name, str part, float version, str ini_path = "../data/", str ip_address = "0.0.0.0", unsigned int port = 50025, offline_mode=False, active_torso=True, str carrier=""):
         """Initialize the Kinematic Writer with given parameters, including the gRPC based connection.
 
         Parameters
@@ -157,6 +159,8 @@ cdef class PyKinematicWriter(PyModuleBase):
             gRPC server ip address. (Default value = "0.0.0.0")
         port : unsigned int
             gRPC server port. (Default value = 50025)
+        carrier : str
+            YARP carrier for the robot connections, e.g. tcp, fast_tcp, shmem, udp; empty: carrier option of the ini file. (Default value = "")
 
         Returns
         -------
@@ -167,7 +171,7 @@ cdef class PyKinematicWriter(PyModuleBase):
         self._part = part
         # preregister module for some prechecks e.g. eye already in use
         if self._register(name, iCub):
-            retval = deref(self._cpp_kin_writer).InitGRPC(part.encode('UTF-8'), version, ini_path.encode('UTF-8'), ip_address.encode('UTF-8'), port, offline_mode, active_torso)
+            retval = deref(self._cpp_kin_writer).InitGRPC(part.encode('UTF-8'), version, ini_path.encode('UTF-8'), ip_address.encode('UTF-8'), port, offline_mode, active_torso, carrier.encode('UTF-8'))
             if not retval:
                 self._unregister(iCub)
             return retval
@@ -37,9 +37,9 @@ cdef extern from "Skin_Reader.hpp":
         SkinReader() except +
 
         # Initialize skin reader with given parameters.
-        bool_t Init(string, char, bool_t, string)
+        bool_t Init(string, char, bool_t, string, string)
 
-        bool_t InitGRPC(string, char, bool_t, string, string, unsigned int)
+        bool_t InitGRPC(string, char, bool_t, string, string, unsigned int, string)
 
         #  Close and clean skin reader
         void Close()
@@ -115,7 +115,7 @@ class PySkinReader:
         """
         ...
 
-    def init(self, iCub: ANNiCub_wrapper, name: str, arm: str, norm=..., ini_path: str = ...) -> bool:
+    def init(self, iCub: ANNiCub_wrapper, name: str, arm: str, norm=..., ini_path: str = ..., carrier: str = ...) -> bool:
         """Initialize skin reader with given parameters.
 
         Parameters
@@ -130,6 +130,8 @@ class PySkinReader:
             if true, the sensor data are returned normalized (iCub [0..255]; normalized [0..1]). (Default value = True)
         ini_path : str
             Path to the "interface_param.ini"-file. (Default value = "../data/")
+        carrier : str
+            YARP carrier for the robot connections, e.g. tcp, fast_tcp, shmem, udp; empty: carrier option of the ini file. (Default value = "")
 
         Returns
         -------
@@ -138,7 +140,7 @@ class PySkinReader:
         """
         ...
 
-    def init_grpc(self, iCub: ANNiCub_wrapper, name: str, arm: str, norm=..., ini_path: str = ..., ip_address: str = ..., port: int = ...) -> bool:
+    def init_grpc(self, iCub: ANNiCub_wrapper, name: str, arm: str, norm=..., ini_path: str = ..., ip_address: str = ..., port: int = ..., carrier: str = ...) -> bool:
         """Initialize the skin reader with given parameters, including the gRPC based connection.
 
         Parameters
@@ -158,6 +160,8 @@ class PySkinReader:
         port : unsigned int
             gRPC server port. (Default value = 50015)
         iCub: ANNiCub_wrapper :
+        carrier : str
+            YARP carrier for the robot connections, e.g. tcp, fast_tcp, shmem, udp; empty: carrier option of the ini file. (Default value = "")
 
         Returns
         -------
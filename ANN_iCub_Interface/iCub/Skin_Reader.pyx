@@ -108,7 +108,7 @@ cdef class PySkinReader(PyModuleBase):
     '''
 
     # init skin reader with given parameters
-    def init(self, ANNiCub_wrapper iCub, str name, str arm, norm=True, str ini_path="../data/"):
+    def init(self, ANNiCub_wrapper iCub, str name, str arm, norm=True, str ini_path="../data/", str carrier=""):
         """Initialize skin reader with given parameters.
 
         Parameters
@@ -123,6 +123,8 @@ cdef class PySkinReader(PyModuleBase):
             if true, the sensor data are returned normalized (iCub [0..255]; normalized [0..1]). (Default value = True)
         ini_path : str
             Path to the "interface_param.ini"-file. (Default value = "../data/")
+        carrier : str
+            YARP carrier for the robot connections, e.g. tcp, fast_tcp, shmem, udp; empty: carrier option of the ini file. (Default value = "")
 
         Returns
         -------
@@ -132,7 +134,7 @@ cdef class PySkinReader(PyModuleBase):
         self._part = arm
         # preregister module for some prechecks e.g. arm already in use
         if self._register(name, iCub):
-            retval = deref(self._cpp_skin_reader).Init(name.encode('UTF-8'), arm.encode('UTF-8')[0], norm.__int__(), ini_path.encode('UTF-8'))
+            retval = deref(self._cpp_skin_reader).Init(name.encode('UTF-8'), arm.encode('UTF-8')[0], norm.__int__(), ini_path.encode('UTF-8'), carrier.encode('UTF-8'))
             if not retval:
                 self._unregister(iCub)
             return retval
@@ -140,7 +142,7 @@ cdef class PySkinReader(PyModuleBase):
             return False
 
     # initialize the skin reader with given parameters, including the gRPC based connection
-    def init_grpc(self, ANNiCub_wrapper iCub, str name, str arm, norm=True, str ini_path="../data/", str ip_address="0.0.0.0", unsigned int port=50015):
+    def init_grpc(self, ANNiCub_wrapper iCub, str name, str arm, norm=True, str ini_path="../data/", str ip_address="0.0.0.0", unsigned int port=50015, str carrier=""):
         """Initialize the skin reader with given parameters, including the gRPC based connection.
 
         Parameters
@@ -159,6 +161,8 @@ cdef class PySkinReader(PyModuleBase):
             gRPC server ip address. (Default value = "0.0.0.0")
         port : unsigned int
             gRPC server port. (Default value = 50015)
+        carrier : str
+            YARP carrier for the robot connections, e.g. tcp, fast_tcp, shmem, udp; empty: carrier option of the ini file. (Default value = "")
 
         Returns
         -------
@@ -169,7 +173,7 @@ cdef class PySkinReader(PyModuleBase):
         self._part = arm
         # preregister module for some prechecks e.g. arm already in use
         if self._register(name, iCub):
-            retval = deref(self._cpp_skin_reader).InitGRPC(name.encode('UTF-8'), arm.encode('UTF-8')[0], norm.__int__(), ini_path.encode('UTF-8'), ip_address.encode('UTF-8'), port)
+            retval = deref(self._cpp_skin_reader).InitGRPC(name.encode('UTF-8'), arm.encode('UTF-8')[0], norm.__int__(), ini_path.encode('UTF-8'), ip_address.encode('UTF-8'), port, carrier.encode('UTF-8'))
             if not retval:
                 self._unregister(iCub)
             return retval
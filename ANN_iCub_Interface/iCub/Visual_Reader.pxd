@@ -27,7 +27,7 @@ from libcpp.vector cimport vector
 from libcpp cimport bool as bool_t
 from libcpp.memory cimport shared_ptr
 from libcpp.map cimport map as cmap
-from libc.stdint cimport uint8_t
+from libc.stdint cimport uint8_t, int8_t
 cimport numpy as np
 
 from .Module_Base_Class cimport Mod_BaseClass, PyModuleBase
@@ -37,25 +37,65 @@ cdef extern from "Visual_Reader.hpp":
     cdef cppclass VisualReader(Mod_BaseClass):
         VisualReader() except +
 
-        ctypedef np.float32_t precision
-
         # Init Visual reader with given parameters for image resolution, field of view and eye selection.
-        bool_t Init(char, double, double, int, int, bool_t, string)
+        bool_t Init(char, double, double, int, int, bool_t, string, string)
 
         # Init Visual reader with given parameters for image resolution, field of view and eye selection and grpc communication.
-        bool_t InitGRPC(char, double, double, int, int, bool_t, string, string, unsigned int)
+        bool_t InitGRPC(char, double, double, int, int, bool_t, string, string, unsigned int, string)
 
         # Read a set of images from the robot cameras.
-        vector[vector[precision]] ReadRobotEyes()
+        vector[vector[double]] ReadRobotEyes()
+
+        # Read a set of images from the robot cameras directly into a caller owned buffer (elements of the output type).
+        bool_t ReadRobotEyesBuffer(void*, size_t)
+
+        # Return the element type of the processed camera images.
+        int GetOutputType()
+
+        # Return the shape of the processed camera images.
+        vector[int] GetOutputShape()
+
+        # Return the shape and the sampling layout of a single processed camera image.
+        vector[int] GetImageShape()
+        int GetImageLayout()
+
+        # Image pyramid: set the number of levels; return the offset table and level sizes; read the pyramids into a caller owned buffer.
+        bool_t SetPyramidLevels(int)
+        vector[size_t] GetPyramidOffsets()
+        vector[int] GetPyramidShapes()
+        bool_t ReadRobotEyesPyramid(void*, size_t)
+
+        # Move the region of view without reinitialization.
+        bool_t SetRegionOfView(double, double, double, double)
 
         vector[uint8_t] RetrieveRobotEye()
 
+        # Select the capture mode (newest frame or next frame).
+        bool_t SetCaptureMode(bool_t)
+
+        # Return the sequence numbers/timestamps of the images returned by the last read call.
+        vector[unsigned long long] GetFrameSequence()
+        vector[double] GetFrameTimestamp()
+
+        # Event output: set the contrast threshold; read the pixels with a log-intensity change above the threshold.
+        bool_t SetEventThreshold(double)
+        bool_t ReadRobotEyesEvents(vector[int]&, vector[int8_t]&, vector[double]&)
+
+        # Disparity output: select the stereo matcher; read the images and the disparity map into caller owned buffers.
+        bool_t SetDisparity(int, int, int)
+        bool_t ReadRobotEyesDisparity(void*, size_t, float*, size_t)
+
+        # Filter bank output: select Gabor or DoG filters; return the response shape; read the responses into a caller owned buffer.
+        bool_t SetGaborFilters(int, vector[double], vector[double])
+        bool_t SetDoGFilters(vector[double], double)
+        vector[int] GetFilterShape()
+        bool_t ReadRobotEyesFiltered(void*, size_t)
+
         # Close Visual Reader module.
         void Close()
 
         # void setRegister(bint)
         # bint getRegister()
-        bool_t double_prec
 
         # cmap[string, string] getParameter()
 
@@ -1,5 +1,5 @@
-from typing import NoReturn
-from numpy import ndarray
+from typing import NoReturn, Sequence, Tuple
+from numpy import dtype, ndarray
 from .iCub_Interface import ANNiCub_wrapper
 
 
@@ -23,7 +23,7 @@ class PyVisualReader:
         ...
 
     def init(self, iCub: ANNiCub_wrapper, name: str, eye: str, fov_width: float = ..., fov_height: float = ...,
-             img_width: int = ..., img_height: int = ..., fast_filter=..., ini_path: str = ...) -> bool:
+             img_width: int = ..., img_height: int = ..., fast_filter=..., ini_path: str = ..., carrier: str = ...) -> bool:
         """Initialize Visual reader with given parameters.
 
         Parameters
@@ -46,6 +46,10 @@ class PyVisualReader:
             flag to select the filter for image upscaling; True for a faster filter. (Default value = True)
         ini_path : str
             Path to the "interface_param.ini"-file. (Default value = "../data/")
+            The [vision] section selects gray/color output, the output dtype (uint8, float16, float32, float64) and the log-polar retina layout
+            (log_polar, log_polar_rings, log_polar_wedges, log_polar_fovea); the retina replaces img_width/img_height by wedges/rings.
+        carrier : str
+            YARP carrier for the robot connections, e.g. tcp, fast_tcp, shmem, udp; empty: carrier option of the ini file. (Default value = "")
 
         Returns
         -------
@@ -55,7 +59,7 @@ class PyVisualReader:
         ...
 
     def init_grpc(self, iCub: ANNiCub_wrapper, name: str, eye: str, fov_width: float = ..., fov_height: float = ..., img_width: int = ...,
-                  img_height: int = ..., fast_filter=..., ini_path: str = ..., ip_address: str = ..., port: int = ...) -> bool:
+                  img_height: int = ..., fast_filter=..., ini_path: str = ..., ip_address: str = ..., port: int = ..., carrier: str = ...) -> bool:
         """Initialize the visual reader with given parameters, including the gRPC based connection.
 
         Parameters
@@ -78,10 +82,14 @@ class PyVisualReader:
             flag to select the filter for image upscaling; True for a faster filter. (Default value = True)
         ini_path : str
             Path to the "interface_param.ini"-file. (Default value = "../data/")
+            The [vision] section selects gray/color output, the output dtype (uint8, float16, float32, float64) and the log-polar retina layout
+            (log_polar, log_polar_rings, log_polar_wedges, log_polar_fovea); the retina replaces img_width/img_height by wedges/rings.
         strip_address : str
             gRPC server ip address. (Default value = "0.0.0.0")
         unsignedintport : int
             gRPC server port. (Default value = 50000)
+        carrier : str
+            YARP carrier for the robot connections, e.g. tcp, fast_tcp, shmem, udp; empty: carrier option of the ini file. (Default value = "")
 
         Returns
         -------
@@ -91,7 +99,7 @@ class PyVisualReader:
         ...
 
     def read_robot_eyes(self) -> ndarray:
-        """Return image_s from the iCub camera_s. The return type depends on the selected precision (float/double).
+        """Return image_s from the iCub camera_s. The return type depends on the selected output dtype (uint8: [0, 255]; float16/32/64: [0., 1.]).
 
         Parameters
         ----------
@@ -99,7 +107,424 @@ class PyVisualReader:
         Returns
         -------
         type
-            NDarray (vector[vector[precision]]): image_s from the camera_s in the form vector of image_s and as flattened image
+            NDarray: image_s from the camera_s in the form vector of image_s and as flattened image
+        """
+        ...
+
+    def read_robot_eyes_into(self, out: ndarray) -> bool:
+        """Read image_s from the iCub camera_s and write them directly into the given array. The array can be reused for every frame,
+           e.g. the array returned by create_output_buffer.
+
+        Parameters
+        ----------
+        out : NDarray
+            C-contiguous array with the shape given by get_output_shape and the dtype given by get_output_dtype
+
+        Returns
+        -------
+        bool
+            return True/False, indicating success/failure
+        """
+        ...
+
+    def get_output_dtype(self) -> dtype:
+        """Return the element type of the processed camera image_s, selected with the "dtype" option in the [vision] section of the ini file.
+
+        Parameters
+        ----------
+
+        Returns
+        -------
+        type
+            numpy dtype: uint8 ([0, 255]), float16, float32 or float64 ([0., 1.])
+        """
+        ...
+
+    def get_output_shape(self) -> tuple:
+        """Return the shape of the processed camera image_s.
+
+        Parameters
+        ----------
+
+        Returns
+        -------
+        tuple
+            (number of images, number of elements per flattened image)
+        """
+        ...
+
+    def get_image_shape(self) -> tuple:
+        """Return the shape of a single processed camera image. For the log-polar layout the height is the number of rings
+           and the width the number of wedges.
+
+        Parameters
+        ----------
+
+        Returns
+        -------
+        tuple
+            (height, width, channels)
+        """
+        ...
+
+    def get_image_layout(self) -> str:
+        """Return the sampling layout of the processed camera images, selected with the "log_polar" option in the [vision] section of the ini-file.
+
+        Parameters
+        ----------
+
+        Returns
+        -------
+        str
+            "cartesian" or "log_polar"
+        """
+        ...
+
+    def create_output_buffer(self) -> ndarray:
+        """Return a new array fitting the processed camera image_s. Can be used as reusable buffer with read_robot_eyes_into.
+
+        Parameters
+        ----------
+
+        Returns
+        -------
+        NDarray
+            uninitialized array with the output shape and the output dtype
+        """
+        ...
+
+    def set_capture_mode(self, threaded: bool) -> bool:
+        """Select the capture mode. The camera images are always received in the background by the shared camera source.
+           In threaded mode read calls return immediately with the newest frame; otherwise they wait for the next camera image.
+
+        Parameters
+        ----------
+        threaded : bool
+            True to return the newest frame; False to wait for the next frame
+
+        Returns
+        -------
+        bool
+            return True/False, indicating success/failure
+        """
+        ...
+
+    def get_frame_sequence(self) -> ndarray:
+        """Return the sequence numbers of the images returned by the last read call (same order as the images).
+           A repeated sequence number marks a frame, which was already returned before.
+
+        Parameters
+        ----------
+
+        Returns
+        -------
+        NDarray
+            frame sequence numbers
+        """
+        ...
+
+    def get_frame_timestamp(self) -> ndarray:
+        """Return the timestamps of the images returned by the last read call (same order as the images).
+
+        Parameters
+        ----------
+
+        Returns
+        -------
+        NDarray
+            frame timestamps in seconds; taken from the YARP envelope if available, otherwise the receive time
+        """
+        ...
+
+    def set_event_threshold(self, threshold: float) -> bool:
+        """Set the contrast threshold for the event output and reset the event reference frame.
+
+        Parameters
+        ----------
+        threshold : double
+            minimal change of the log-intensity, which triggers an event (> 0). (Default of the reader = 0.15)
+
+        Returns
+        -------
+        bool
+            return True/False, indicating success/failure
+        """
+        ...
+
+    def read_robot_eyes_events(self) -> Tuple[ndarray, ndarray, ndarray]:
+        """Read image_s from the iCub camera_s and return only the pixels, whose log-intensity changed by more than the event threshold
+           since their last event (event-camera emulation). The first call after init/set_event_threshold only sets the reference frame.
+
+        Parameters
+        ----------
+
+        Returns
+        -------
+        tuple
+            (index, polarity, timestamp) as NDarrays: flattened pixel indices referring to the layout of read_robot_eyes (int32),
+            event polarities; 1: brighter, -1: darker (int8) and frame timestamps in seconds (float64)
+        """
+        ...
+
+    def set_disparity(self, method: str = "bm", num_disparities: int = 64, block_size: int = 15) -> bool:
+        """Select the stereo matcher for the disparity output. Only available in 'B' mode with the cartesian layout.
+           The camera images are assumed to be rectified.
+
+        Parameters
+        ----------
+        method : str
+            matching algorithm: "bm" (block matching) or "sgbm" (semi-global block matching). (Default value = "bm")
+        num_disparities : int
+            disparity search range in output pixels; positive multiple of 16, smaller than the output width. (Default value = 64)
+        block_size : int
+            size of the matched blocks in output pixels; odd, for block matching in [5, 255]. (Default value = 15)
+
+        Returns
+        -------
+        bool
+            return True/False, indicating success/failure
+        """
+        ...
+
+    def create_disparity_buffer(self) -> ndarray:
+        """Return a new array fitting the disparity map. Can be used as reusable buffer with read_robot_eyes_disparity_into.
+
+        Parameters
+        ----------
+
+        Returns
+        -------
+        NDarray
+            uninitialized float32 array with the shape (height, width) of the output image
+        """
+        ...
+
+    def read_robot_eyes_disparity_into(self, out: ndarray, disparity: ndarray) -> bool:
+        """Read the images from both iCub cameras and compute the disparity map of the image pair at the output resolution
+           (reference: left eye). Requires a stereo matcher selected with set_disparity.
+
+        Parameters
+        ----------
+        out : NDarray
+            C-contiguous array with the shape given by get_output_shape and the dtype given by get_output_dtype
+        disparity : NDarray
+            C-contiguous float32 array with the shape (height, width) of the output image, e.g. the array returned by create_disparity_buffer
+
+        Returns
+        -------
+        bool
+            return True/False, indicating success/failure
+        """
+        ...
+
+    def read_robot_eyes_disparity(self) -> Tuple[ndarray, ndarray]:
+        """Read the images from both iCub cameras and return them together with the disparity map of the image pair (reference: left eye).
+
+        Parameters
+        ----------
+
+        Returns
+        -------
+        tuple
+            (images, disparity) as NDarrays: images as in read_robot_eyes (right, left) and the disparity map (height, width) in
+            output pixels (float32); -1 marks pixels without a valid match
+        """
+        ...
+
+    def set_gabor_filters(self, orientations: int = 4, wavelengths: Sequence[float] = (4., 8.), phases: Sequence[float] = (0., 90.)) -> bool:
+        """Select a bank of oriented Gabor filters as output stage, applied on a worker pool in C++. Only available for the cartesian layout;
+           color images are converted to gray before the filtering. The maps are ordered by wavelength, orientation and phase.
+
+        Parameters
+        ----------
+        orientations : int
+            number of orientations, equally spaced in [0°, 180°). (Default value = 4)
+        wavelengths : list
+            wavelengths of the sinusoidal carrier in output pixels (>= 2); one scale per wavelength. (Default value = (4., 8.))
+        phases : list
+            phase offsets of the carrier in degree; 0: even/symmetric, 90: odd/antisymmetric. (Default value = (0., 90.))
+
+        Returns
+        -------
+        bool
+            return True/False, indicating success/failure
+        """
+        ...
+
+    def set_dog_filters(self, sigmas: Sequence[float] = (1., 2.), surround_ratio: float = 1.6) -> bool:
+        """Select a bank of ON/OFF difference-of-Gaussians as output stage, applied on a worker pool in C++. Only available for the cartesian layout;
+           color images are converted to gray before the filtering. Each scale yields an ON and an OFF map.
+
+        Parameters
+        ----------
+        sigmas : list
+            standard deviations of the center Gaussians in output pixels; one scale per sigma. (Default value = (1., 2.))
+        surround_ratio : double
+            ratio of the surround and the center standard deviation (> 1). (Default value = 1.6)
+
+        Returns
+        -------
+        bool
+            return True/False, indicating success/failure
+        """
+        ...
+
+    def get_filter_shape(self) -> Tuple[int, int, int]:
+        """Return the shape of the filter responses of a single image.
+
+        Parameters
+        ----------
+
+        Returns
+        -------
+        tuple
+            (number of filter maps, height, width); zeros if no filter bank is selected
+        """
+        ...
+
+    def create_filter_buffer(self) -> ndarray:
+        """Return a new array fitting the filter responses of all image_s. Can be used as reusable buffer with read_robot_eyes_filtered_into.
+
+        Parameters
+        ----------
+
+        Returns
+        -------
+        NDarray
+            uninitialized array with the shape (number of images, filters, height, width) and the output dtype
+        """
+        ...
+
+    def read_robot_eyes_filtered_into(self, out: ndarray) -> bool:
+        """Read image_s from the iCub camera_s and write the filter bank responses into the given array. Gabor responses are in [-1, 1],
+           DoG responses in [0, 1]; the uint8 output stores Gabor responses as 127.5 * (1 + r) (zero response at 127.5) and DoG responses scaled by 255.
+
+        Parameters
+        ----------
+        out : NDarray
+            C-contiguous array with the shape (number of images, filters, height, width) and the dtype given by get_output_dtype
+
+        Returns
+        -------
+        bool
+            return True/False, indicating success/failure
+        """
+        ...
+
+    def read_robot_eyes_filtered(self) -> ndarray:
+        """Read image_s from the iCub camera_s and return the filter bank responses as one contiguous tensor.
+
+        Parameters
+        ----------
+
+        Returns
+        -------
+        NDarray
+            filter responses with the shape (number of images, filters, height, width); binocular: right eye first
+        """
+        ...
+
+    def set_pyramid_levels(self, levels: int) -> bool:
+        """Set the number of levels of the image pyramid returned by read_robot_eyes_pyramid.
+
+        Parameters
+        ----------
+        levels : int
+            number of levels; level 0 is the processed image, each further level halves the image size (area downscaling)
+
+        Returns
+        -------
+        bool
+            return True/False, indicating success/failure
+        """
+        ...
+
+    def get_pyramid_offsets(self) -> ndarray:
+        """Return the offset table of the pyramid buffer.
+
+        Parameters
+        ----------
+
+        Returns
+        -------
+        NDarray
+            start offsets of all levels for each image (right eye first in binocular mode) and the total buffer size as last entry
+        """
+        ...
+
+    def get_pyramid_shapes(self) -> list:
+        """Return the image size of the pyramid levels.
+
+        Parameters
+        ----------
+
+        Returns
+        -------
+        list
+            (height, width) for each level
+        """
+        ...
+
+    def create_pyramid_buffer(self) -> ndarray:
+        """Return a new array fitting the image pyramid_s. Can be used as reusable buffer with read_robot_eyes_pyramid_into.
+
+        Parameters
+        ----------
+
+        Returns
+        -------
+        NDarray
+            uninitialized 1D-array with the pyramid buffer size and the output dtype
+        """
+        ...
+
+    def read_robot_eyes_pyramid_into(self, out: ndarray) -> bool:
+        """Read image_s from the iCub camera_s and write the image pyramid_s into the given array. All levels are computed from one capture.
+
+        Parameters
+        ----------
+        out : NDarray
+            C-contiguous 1D-array with the size given by the last entry of get_pyramid_offsets and the dtype given by get_output_dtype
+
+        Returns
+        -------
+        bool
+            return True/False, indicating success/failure
+        """
+        ...
+
+    def read_robot_eyes_pyramid(self) -> Tuple[ndarray, ndarray]:
+        """Read image_s from the iCub camera_s and return the image pyramid_s as one contiguous buffer.
+
+        Parameters
+        ----------
+
+        Returns
+        -------
+        tuple
+            (buffer, offsets): flattened levels of all image_s and the offset table (see get_pyramid_offsets)
+        """
+        ...
+
+    def set_region_of_view(self, center_x: float, center_y: float, fov_width: float, fov_height: float) -> bool:
+        """Move the region of view (cropped field of view) without reinitialization, e.g. for an attention window. The output image size is kept;
+           the resampling tables are computed in the background of the reads and apply from the next frame of each eye on.
+
+        Parameters
+        ----------
+        center_x : double
+            horizontal center of the region of view in degree (0: optical axis; positive: right)
+        center_y : double
+            vertical center of the region of view in degree (0: optical axis; positive: up)
+        fov_width : double
+            field of view width in degree; the region has to stay inside the camera field of view (60°)
+        fov_height : double
+            field of view height in degree; the region has to stay inside the camera field of view (48°)
+
+        Returns
+        -------
+        bool
+            return True/False, indicating success/failure; on failure the previous region of view is kept
         """
         ...
 
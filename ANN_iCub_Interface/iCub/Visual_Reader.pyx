@@ -23,6 +23,9 @@
  """
 
 from libcpp.memory cimport make_shared
+from libcpp.vector cimport vector
+from libc.stdint cimport int8_t
+from libc.string cimport memcpy
 from cython.operator cimport dereference as deref
 
 from .Visual_Reader cimport VisualReader
@@ -31,6 +34,9 @@ from .Module_Base_Class cimport PyModuleBase
 
 import numpy as np
 
+# numpy types of the output element types of the Visual Reader -> index: type id returned by GetOutputType
+_output_dtypes = (np.uint8, np.float16, np.float32, np.float64)
+
 cdef class PyVisualReader(PyModuleBase):
 
     # init method
@@ -107,7 +113,7 @@ cdef class PyVisualReader(PyModuleBase):
 
     # init Visual reader with given parameters for image resolution, field of view and eye selection
     def init(self, ANNiCub_wrapper iCub, str name, str eye, double fov_width=60., double fov_height=48., int img_width=320, int img_height=240, fast_filter=True,
-             str ini_path="../data/"):
+             str ini_path="../data/", str carrier=""):
         """Initialize Visual reader with given parameters.
 
         Parameters
@@ -130,6 +136,10 @@ cdef class PyVisualReader(PyModuleBase):
             flag to select the filter for image upscaling; True for a faster filter. (Default value = True)
         ini_path : str
             Path to the "interface_param.ini"-file. (Default value = "../data/")
+            The [vision] section selects gray/color output, the output dtype (uint8, float16, float32, float64) and the log-polar retina layout
+            (log_polar, log_polar_rings, log_polar_wedges, log_polar_fovea); the retina replaces img_width/img_height by wedges/rings.
+        carrier : str
+            YARP carrier for the robot connections, e.g. tcp, fast_tcp, shmem, udp; empty: carrier option of the ini file. (Default value = "")
 
         Returns
         -------
@@ -141,7 +151,7 @@ cdef class PyVisualReader(PyModuleBase):
         # preregister module for some prechecks e.g. name already in use
         if self._register(name, iCub):
             # call the interface
-            retval = deref(self._cpp_visual_reader).Init(eye.encode('UTF-8')[0], fov_width, fov_height, img_width, img_height, fast_filter, ini_path.encode('UTF-8'))
+            retval = deref(self._cpp_visual_reader).Init(eye.encode('UTF-8')[0], fov_width, fov_height, img_width, img_height, fast_filter, ini_path.encode('UTF-8'), carrier.encode('UTF-8'))
             if not retval:
                 self._unregister(iCub)
             return retval
@@ -150,7 +160,7 @@ cdef class PyVisualReader(PyModuleBase):
 
     # init Visual reader with given parameters for image resolution, field of view and eye selection
     def init_grpc(self, ANNiCub_wrapper iCub, str name, str eye, double fov_width=60, double fov_height=48, int img_width=320, int img_height=240, fast_filter=True,
-                  str ini_path="../data/", str ip_address="0.0.0.0", unsigned int port=50000):
+                  str ini_path="../data/", str ip_address="0.0.0.0", unsigned int port=50000, str carrier=""):
         """Initialize the visual reader with given parameters, including the gRPC based connection.
 
         Parameters
@@ -173,10 +183,14 @@ cdef class PyVisualReader(PyModuleBase):
             flag to select the filter for image upscaling; True for a faster filter. (Default value = True)
         ini_path : str
             Path to the "interface_param.ini"-file. (Default value = "../data/")
+            The [vision] section selects gray/color output, the output dtype (uint8, float16, float32, float64) and the log-polar retina layout
+            (log_polar, log_polar_rings, log_polar_wedges, log_polar_fovea); the retina replaces img_width/img_height by wedges/rings.
         ip_address : str
             gRPC server ip address. (Default value = "0.0.0.0")
         port : unsigned int
             gRPC server port. (Default value = 50000)
+        carrier : str
+            YARP carrier for the robot connections, e.g. tcp, fast_tcp, shmem, udp; empty: carrier option of the ini file. (Default value = "")
 
         Returns
         -------
@@ -187,7 +201,7 @@ cdef class PyVisualReader(PyModuleBase):
         # preregister module for some prechecks e.g. eye already in use
         if self._register(name, iCub):
             retval = deref(self._cpp_visual_reader).InitGRPC(eye.encode('UTF-8')[0], fov_width, fov_height, img_width, img_height, fast_filter, ini_path.encode('UTF-8'),
-                                                             ip_address.encode('UTF-8'), port)
+                                                             ip_address.encode('UTF-8'), port, carrier.encode('UTF-8'))
             if not retval:
                 self._unregister(iCub)
             return retval
@@ -196,7 +210,7 @@ cdef class PyVisualReader(PyModuleBase):
 
     # return camera image_s in a vector
     def read_robot_eyes(self):
-        """Return image_s from the iCub camera_s. The return type depends on the selected precision (float/double).
+        """Return image_s from the iCub camera_s. The return type depends on the selected output dtype (uint8: [0, 255]; float16/32/64: [0., 1.]).
 
         Parameters
         ----------
@@ -204,15 +218,242 @@ cdef class PyVisualReader(PyModuleBase):
         Returns
         -------
         type
-            NDarray (vector[vector[precision]]): image_s from the camera_s in the form vector of image_s and as flattened image
+            NDarray: image_s from the camera_s in the form vector of image_s and as flattened image
         """
-        #return np.array(deref(self._cpp_visual_reader).ReadRobotEyes(), dtype=VisualReader.precision)
-        img = deref(self._cpp_visual_reader).ReadRobotEyes()
-        if deref(self._cpp_visual_reader).double_prec:
-            return np.array(img, dtype=np.float64)
-        else:
-            return np.array(img, dtype=np.float32)
-        
+        img = self.create_output_buffer()
+        if img.size > 0 and self.read_robot_eyes_into(img):
+            return img
+        return np.array([], dtype=img.dtype)
+
+    # write camera image_s into a preallocated array
+    def read_robot_eyes_into(self, out):
+        """Read image_s from the iCub camera_s and write them directly into the given array. The array can be reused for every frame,
+           e.g. the array returned by create_output_buffer.
+
+        Parameters
+        ----------
+        out : NDarray
+            C-contiguous array with the shape given by get_output_shape and the dtype given by get_output_dtype
+
+        Returns
+        -------
+        bool
+            return True/False, indicating success/failure
+        """
+        cdef unsigned char[::1] raw
+
+        if tuple(out.shape) != self.get_output_shape():
+            print("[Interface iCub] Visual Reader buffer shape does not match the output shape!")
+            return False
+        if out.dtype != self.get_output_dtype() or not out.flags['C_CONTIGUOUS']:
+            print("[Interface iCub] Visual Reader buffer has to be C-contiguous with the output dtype!")
+            return False
+        if out.size == 0:
+            return False
+
+        raw = out.reshape(-1).view(np.uint8)
+        return deref(self._cpp_visual_reader).ReadRobotEyesBuffer(<void*> &raw[0], out.size)
+
+    # return the element type of the processed camera image_s
+    def get_output_dtype(self):
+        """Return the element type of the processed camera image_s, selected with the "dtype" option in the [vision] section of the ini file.
+
+        Parameters
+        ----------
+
+        Returns
+        -------
+        type
+            numpy dtype: uint8 ([0, 255]), float16, float32 or float64 ([0., 1.])
+        """
+        output_type = deref(self._cpp_visual_reader).GetOutputType()
+        if output_type < 0:
+            return np.dtype(np.float64)
+        return np.dtype(_output_dtypes[output_type])
+
+    # return the shape of the processed camera image_s
+    def get_output_shape(self):
+        """Return the shape of the processed camera image_s.
+
+        Parameters
+        ----------
+
+        Returns
+        -------
+        tuple
+            (number of images, number of elements per flattened image)
+        """
+        return tuple(deref(self._cpp_visual_reader).GetOutputShape())
+
+    # return the shape of a single processed camera image
+    def get_image_shape(self):
+        """Return the shape of a single processed camera image. For the log-polar layout the height is the number of rings
+           and the width the number of wedges.
+
+        Parameters
+        ----------
+
+        Returns
+        -------
+        tuple
+            (height, width, channels)
+        """
+        return tuple(deref(self._cpp_visual_reader).GetImageShape())
+
+    # return the sampling layout of the processed camera image_s
+    def get_image_layout(self):
+        """Return the sampling layout of the processed camera images, selected with the "log_polar" option in the [vision] section of the ini-file.
+
+        Parameters
+        ----------
+
+        Returns
+        -------
+        str
+            "cartesian" or "log_polar"
+        """
+        return {0: "cartesian", 1: "log_polar"}.get(deref(self._cpp_visual_reader).GetImageLayout(), "")
+
+    # return a new array fitting the camera image_s
+    def create_output_buffer(self):
+        """Return a new array fitting the processed camera image_s. Can be used as reusable buffer with read_robot_eyes_into.
+
+        Parameters
+        ----------
+
+        Returns
+        -------
+        NDarray
+            uninitialized array with the output shape and the output dtype
+        """
+        return np.empty(self.get_output_shape(), dtype=self.get_output_dtype())
+
+    # set the number of pyramid levels
+    def set_pyramid_levels(self, int levels):
+        """Set the number of levels of the image pyramid returned by read_robot_eyes_pyramid.
+
+        Parameters
+        ----------
+        levels : int
+            number of levels; level 0 is the processed image, each further level halves the image size (area downscaling)
+
+        Returns
+        -------
+        bool
+            return True/False, indicating success/failure
+        """
+        return deref(self._cpp_visual_reader).SetPyramidLevels(levels)
+
+    # return the offset table of the pyramid buffer
+    def get_pyramid_offsets(self):
+        """Return the offset table of the pyramid buffer.
+
+        Parameters
+        ----------
+
+        Returns
+        -------
+        NDarray
+            start offsets of all levels for each image (right eye first in binocular mode) and the total buffer size as last entry
+        """
+        return np.array(deref(self._cpp_visual_reader).GetPyramidOffsets(), dtype=np.int64)
+
+    # return the image size of the pyramid levels
+    def get_pyramid_shapes(self):
+        """Return the image size of the pyramid levels.
+
+        Parameters
+        ----------
+
+        Returns
+        -------
+        list
+            (height, width) for each level
+        """
+        shapes = deref(self._cpp_visual_reader).GetPyramidShapes()
+        return [(shapes[i], shapes[i + 1]) for i in range(0, len(shapes), 2)]
+
+    # return a new array fitting the image pyramid_s
+    def create_pyramid_buffer(self):
+        """Return a new array fitting the image pyramid_s. Can be used as reusable buffer with read_robot_eyes_pyramid_into.
+
+        Parameters
+        ----------
+
+        Returns
+        -------
+        NDarray
+            uninitialized 1D-array with the pyramid buffer size and the output dtype
+        """
+        return np.empty(self.get_pyramid_offsets()[-1], dtype=self.get_output_dtype())
+
+    # write the image pyramid_s into a preallocated array
+    def read_robot_eyes_pyramid_into(self, out):
+        """Read image_s from the iCub camera_s and write the image pyramid_s into the given array. All levels are computed from one capture.
+
+        Parameters
+        ----------
+        out : NDarray
+            C-contiguous 1D-array with the size given by the last entry of get_pyramid_offsets and the dtype given by get_output_dtype
+
+        Returns
+        -------
+        bool
+            return True/False, indicating success/failure
+        """
+        cdef unsigned char[::1] raw
+
+        if out.ndim != 1 or out.size != self.get_pyramid_offsets()[-1]:
+            print("[Interface iCub] Visual Reader buffer size does not match the pyramid size!")
+            return False
+        if out.dtype != self.get_output_dtype() or not out.flags['C_CONTIGUOUS']:
+            print("[Interface iCub] Visual Reader buffer has to be C-contiguous with the output dtype!")
+            return False
+        if out.size == 0:
+            return False
+
+        raw = out.view(np.uint8)
+        return deref(self._cpp_visual_reader).ReadRobotEyesPyramid(<void*> &raw[0], out.size)
+
+    # return the image pyramid_s and the offset table
+    def read_robot_eyes_pyramid(self):
+        """Read image_s from the iCub camera_s and return the image pyramid_s as one contiguous buffer.
+
+        Parameters
+        ----------
+
+        Returns
+        -------
+        tuple
+            (buffer, offsets): flattened levels of all image_s and the offset table (see get_pyramid_offsets)
+        """
+        buffer = self.create_pyramid_buffer()
+        if buffer.size > 0 and self.read_robot_eyes_pyramid_into(buffer):
+            return buffer, self.get_pyramid_offsets()
+        return np.array([], dtype=buffer.dtype), np.array([], dtype=np.int64)
+
+    # move the region of view
+    def set_region_of_view(self, double center_x, double center_y, double fov_width, double fov_height):
+        """Move the region of view (cropped field of view) without reinitialization, e.g. for an attention window. The output image size is kept;
+           the resampling tables are computed in the background of the reads and apply from the next frame of each eye on.
+
+        Parameters
+        ----------
+        center_x : double
+            horizontal center of the region of view in degree (0: optical axis; positive: right)
+        center_y : double
+            vertical center of the region of view in degree (0: optical axis; positive: up)
+        fov_width : double
+            field of view width in degree; the region has to stay inside the camera field of view (60°)
+        fov_height : double
+            field of view height in degree; the region has to stay inside the camera field of view (48°)
+
+        Returns
+        -------
+        bool
+            return True/False, indicating success/failure; on failure the previous region of view is kept
+        """
+        return deref(self._cpp_visual_reader).SetRegionOfView(center_x, center_y, fov_width, fov_height)
 
     # return flattened RGB-image
     def retrieve_robot_eye(self):
@@ -229,6 +470,311 @@ cdef class PyVisualReader(PyModuleBase):
         return np.array(deref(self._cpp_visual_reader).RetrieveRobotEye(), dtype=np.uint8)
         # return deref(self._cpp_visual_reader).RetrieveRobotEye()
 
+    # select the capture mode
+    def set_capture_mode(self, bint threaded):
+        """Select the capture mode. The camera images are always received in the background by the shared camera source.
+           In threaded mode read calls return immediately with the newest frame; otherwise they wait for the next camera image.
+
+        Parameters
+        ----------
+        threaded : bool
+            True to return the newest frame; False to wait for the next frame
+
+        Returns
+        -------
+        bool
+            return True/False, indicating success/failure
+        """
+        return deref(self._cpp_visual_reader).SetCaptureMode(threaded)
+
+    # return the sequence numbers of the last returned frames
+    def get_frame_sequence(self):
+        """Return the sequence numbers of the images returned by the last read call (same order as the images).
+           A repeated sequence number marks a frame, which was already returned before.
+
+        Parameters
+        ----------
+
+        Returns
+        -------
+        NDarray
+            frame sequence numbers
+        """
+        return np.array(deref(self._cpp_visual_reader).GetFrameSequence(), dtype=np.uint64)
+
+    # return the timestamps of the last returned frames
+    def get_frame_timestamp(self):
+        """Return the timestamps of the images returned by the last read call (same order as the images).
+
+        Parameters
+        ----------
+
+        Returns
+        -------
+        NDarray
+            frame timestamps in seconds; taken from the YARP envelope if available, otherwise the receive time
+        """
+        return np.array(deref(self._cpp_visual_reader).GetFrameTimestamp(), dtype=np.float64)
+
+    # set the contrast threshold of the event output
+    def set_event_threshold(self, double threshold):
+        """Set the contrast threshold for the event output and reset the event reference frame.
+
+        Parameters
+        ----------
+        threshold : double
+            minimal change of the log-intensity, which triggers an event (> 0). (Default of the reader = 0.15)
+
+        Returns
+        -------
+        bool
+            return True/False, indicating success/failure
+        """
+        return deref(self._cpp_visual_reader).SetEventThreshold(threshold)
+
+    # return the events since the last call
+    def read_robot_eyes_events(self):
+        """Read image_s from the iCub camera_s and return only the pixels, whose log-intensity changed by more than the event threshold
+           since their last event (event-camera emulation). The first call after init/set_event_threshold only sets the reference frame.
+
+        Parameters
+        ----------
+
+        Returns
+        -------
+        tuple
+            (index, polarity, timestamp) as NDarrays: flattened pixel indices referring to the layout of read_robot_eyes (int32),
+            event polarities; 1: brighter, -1: darker (int8) and frame timestamps in seconds (float64)
+        """
+        cdef vector[int] index
+        cdef vector[int8_t] polarity
+        cdef vector[double] timestamp
+
+        deref(self._cpp_visual_reader).ReadRobotEyesEvents(index, polarity, timestamp)
+
+        # copy the events as blocks instead of converting them element wise into python lists
+        cdef size_t n = index.size()
+        ev_index = np.empty(n, dtype=np.int32)
+        ev_polarity = np.empty(n, dtype=np.int8)
+        ev_timestamp = np.empty(n, dtype=np.float64)
+        cdef int[::1] index_view = ev_index
+        cdef int8_t[::1] polarity_view = ev_polarity
+        cdef double[::1] timestamp_view = ev_timestamp
+        if n > 0:
+            memcpy(&index_view[0], index.data(), n * sizeof(int))
+            memcpy(&polarity_view[0], polarity.data(), n * sizeof(int8_t))
+            memcpy(&timestamp_view[0], timestamp.data(), n * sizeof(double))
+        return ev_index, ev_polarity, ev_timestamp
+
+    # select the stereo matcher of the disparity output
+    def set_disparity(self, str method="bm", int num_disparities=64, int block_size=15):
+        """Select the stereo matcher for the disparity output. Only available in 'B' mode with the cartesian layout.
+           The camera images are assumed to be rectified.
+
+        Parameters
+        ----------
+        method : str
+            matching algorithm: "bm" (block matching) or "sgbm" (semi-global block matching). (Default value = "bm")
+        num_disparities : int
+            disparity search range in output pixels; positive multiple of 16, smaller than the output width. (Default value = 64)
+        block_size : int
+            size of the matched blocks in output pixels; odd, for block matching in [5, 255]. (Default value = 15)
+
+        Returns
+        -------
+        bool
+            return True/False, indicating success/failure
+        """
+        methods = {"bm": 0, "sgbm": 1}
+        if method not in methods:
+            print("[Interface iCub] Visual Reader stereo method has to be \"bm\" or \"sgbm\"!")
+            return False
+        return deref(self._cpp_visual_reader).SetDisparity(methods[method], num_disparities, block_size)
+
+    # return a new array fitting the disparity map
+    def create_disparity_buffer(self):
+        """Return a new array fitting the disparity map. Can be used as reusable buffer with read_robot_eyes_disparity_into.
+
+        Parameters
+        ----------
+
+        Returns
+        -------
+        NDarray
+            uninitialized float32 array with the shape (height, width) of the output image
+        """
+        shape = self.get_image_shape()
+        return np.empty((shape[0], shape[1]), dtype=np.float32)
+
+    # write the image_s and the disparity map into preallocated arrays
+    def read_robot_eyes_disparity_into(self, out, disparity):
+        """Read the images from both iCub cameras and compute the disparity map of the image pair at the output resolution
+           (reference: left eye). Requires a stereo matcher selected with set_disparity.
+
+        Parameters
+        ----------
+        out : NDarray
+            C-contiguous array with the shape given by get_output_shape and the dtype given by get_output_dtype
+        disparity : NDarray
+            C-contiguous float32 array with the shape (height, width) of the output image, e.g. the array returned by create_disparity_buffer
+
+        Returns
+        -------
+        bool
+            return True/False, indicating success/failure
+        """
+        cdef unsigned char[::1] raw
+        cdef float[::1] disp
+
+        if tuple(out.shape) != self.get_output_shape():
+            print("[Interface iCub] Visual Reader buffer shape does not match the output shape!")
+            return False
+        if out.dtype != self.get_output_dtype() or not out.flags['C_CONTIGUOUS']:
+            print("[Interface iCub] Visual Reader buffer has to be C-contiguous with the output dtype!")
+            return False
+        if disparity.dtype != np.float32 or not disparity.flags['C_CONTIGUOUS']:
+            print("[Interface iCub] Visual Reader disparity buffer has to be C-contiguous with dtype float32!")
+            return False
+        if out.size == 0 or disparity.size == 0:
+            return False
+
+        raw = out.reshape(-1).view(np.uint8)
+        disp = disparity.reshape(-1)
+        return deref(self._cpp_visual_reader).ReadRobotEyesDisparity(<void*> &raw[0], out.size, &disp[0], disparity.size)
+
+    # return the image_s and the disparity map
+    def read_robot_eyes_disparity(self):
+        """Read the images from both iCub cameras and return them together with the disparity map of the image pair (reference: left eye).
+
+        Parameters
+        ----------
+
+        Returns
+        -------
+        tuple
+            (images, disparity) as NDarrays: images as in read_robot_eyes (right, left) and the disparity map (height, width) in
+            output pixels (float32); -1 marks pixels without a valid match
+        """
+        images = self.create_output_buffer()
+        disparity = self.create_disparity_buffer()
+        if images.size > 0 and self.read_robot_eyes_disparity_into(images, disparity):
+            return images, disparity
+        return np.array([], dtype=images.dtype), np.array([], dtype=np.float32)
+
+    # select a Gabor filter bank as output stage
+    def set_gabor_filters(self, int orientations=4, wavelengths=(4., 8.), phases=(0., 90.)):
+        """Select a bank of oriented Gabor filters as output stage, applied on a worker pool in C++. Only available for the cartesian layout;
+           color images are converted to gray before the filtering. The maps are ordered by wavelength, orientation and phase.
+
+        Parameters
+        ----------
+        orientations : int
+            number of orientations, equally spaced in [0°, 180°). (Default value = 4)
+        wavelengths : list
+            wavelengths of the sinusoidal carrier in output pixels (>= 2); one scale per wavelength. (Default value = (4., 8.))
+        phases : list
+            phase offsets of the carrier in degree; 0: even/symmetric, 90: odd/antisymmetric. (Default value = (0., 90.))
+
+        Returns
+        -------
+        bool
+            return True/False, indicating success/failure
+        """
+        return deref(self._cpp_visual_reader).SetGaborFilters(orientations, wavelengths, phases)
+
+    # select a difference-of-Gaussians filter bank as output stage
+    def set_dog_filters(self, sigmas=(1., 2.), double surround_ratio=1.6):
+        """Select a bank of ON/OFF difference-of-Gaussians as output stage, applied on a worker pool in C++. Only available for the cartesian layout;
+           color images are converted to gray before the filtering. Each scale yields an ON and an OFF map.
+
+        Parameters
+        ----------
+        sigmas : list
+            standard deviations of the center Gaussians in output pixels; one scale per sigma. (Default value = (1., 2.))
+        surround_ratio : double
+            ratio of the surround and the center standard deviation (> 1). (Default value = 1.6)
+
+        Returns
+        -------
+        bool
+            return True/False, indicating success/failure
+        """
+        return deref(self._cpp_visual_reader).SetDoGFilters(sigmas, surround_ratio)
+
+    # return the shape of the filter responses
+    def get_filter_shape(self):
+        """Return the shape of the filter responses of a single image.
+
+        Parameters
+        ----------
+
+        Returns
+        -------
+        tuple
+            (number of filter maps, height, width); zeros if no filter bank is selected
+        """
+        return tuple(deref(self._cpp_visual_reader).GetFilterShape())
+
+    # return a new array fitting the filter responses
+    def create_filter_buffer(self):
+        """Return a new array fitting the filter responses of all image_s. Can be used as reusable buffer with read_robot_eyes_filtered_into.
+
+        Parameters
+        ----------
+
+        Returns
+        -------
+        NDarray
+            uninitialized array with the shape (number of images, filters, height, width) and the output dtype
+        """
+        return np.empty((self.get_output_shape()[0],) + self.get_filter_shape(), dtype=self.get_output_dtype())
+
+    # write the filter responses into a preallocated array
+    def read_robot_eyes_filtered_into(self, out):
+        """Read image_s from the iCub camera_s and write the filter bank responses into the given array. Gabor responses are in [-1, 1],
+           DoG responses in [0, 1]; the uint8 output stores Gabor responses as 127.5 * (1 + r) (zero response at 127.5) and DoG responses scaled by 255.
+
+        Parameters
+        ----------
+        out : NDarray
+            C-contiguous array with the shape (number of images, filters, height, width) and the dtype given by get_output_dtype
+
+        Returns
+        -------
+        bool
+            return True/False, indicating success/failure
+        """
+        cdef unsigned char[::1] raw
+
+        if tuple(out.shape) != (self.get_output_shape()[0],) + self.get_filter_shape():
+            print("[Interface iCub] Visual Reader buffer shape does not match the filter output shape!")
+            return False
+        if out.dtype != self.get_output_dtype() or not out.flags['C_CONTIGUOUS']:
+            print("[Interface iCub] Visual Reader buffer has to be C-contiguous with the output dtype!")
+            return False
+        if out.size == 0:
+            return False
+
+        raw = out.reshape(-1).view(np.uint8)
+        return deref(self._cpp_visual_reader).ReadRobotEyesFiltered(<void*> &raw[0], out.size)
+
+    # return the filter responses
+    def read_robot_eyes_filtered(self):
+        """Read image_s from the iCub camera_s and return the filter bank responses as one contiguous tensor.
+
+        Parameters
+        ----------
+
+        Returns
+        -------
+        NDarray
+            filter responses with the shape (number of images, filters, height, width); binocular: right eye first
+        """
+        buffer = self.create_filter_buffer()
+        if buffer.size > 0 and self.read_robot_eyes_filtered_into(buffer):
+            return buffer
+        return np.array([], dtype=buffer.dtype)
+
     # close module
     def close(self, ANNiCub_wrapper iCub):
         """Close the visual reader module
@@ -0,0 +1,114 @@
+/*
+ *  Copyright (C) 2019-2024 Torsten Fietzek
+ *
+ *  Camera_Source.hpp is part of the ANNarchy iCub interface
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  The ANNarchy iCub interface is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this headers. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include <yarp/os/all.h>
+#include <yarp/sig/all.h>
+
+#include <atomic>
+#include <condition_variable>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+/**
+ * \brief Camera image with the respective meta data.
+ */
+struct CameraFrame {
+    yarp::sig::ImageOf<yarp::sig::PixelRgb> image;    // camera image
+    double timestamp = 0.;                            // timestamp of the camera image in seconds
+    unsigned long long sequence = 0;                  // running number of the received camera images; 0 -> no image
+};
+
+/**
+ * \brief Process-wide shared receiver for one robot camera port. All Visual Readers of the same camera subscribe to one source,
+ *        therefore every frame is transferred and deserialized only once. The frames are shared read-only with the readers.
+ */
+class CameraSource {
+ public:
+    /**
+     * \brief Return the camera source for the given robot port; the source is created and connected with the first subscription
+     *        and closed, when the last subscriber releases it. A source, which stopped after a failed read, is replaced by a new connection.
+     * \param[in] robot_port name of the robot camera port
+     * \param[in] client_port_prefix client port name prefix for the local receiving port
+     * \param[in] carrier YARP carrier of the connection (empty: YARP default); only used by the first subscription, which creates the connection
+     * \return shared camera source; nullptr if the port could not be connected
+     */
+    static std::shared_ptr<CameraSource> Subscribe(const std::string &robot_port, const std::string &client_port_prefix, const std::string &carrier = "");
+
+    /**
+     * \brief Stop the receiving thread, disconnect and close the port.
+     */
+    ~CameraSource();
+
+    CameraSource(const CameraSource &) = delete;
+    CameraSource &operator=(const CameraSource &) = delete;
+
+    /**
+     * \brief Return a frame with a higher sequence number than the given one; waits until such a frame is received.
+     * \param[in] sequence sequence number to compare with; 0 returns the newest frame, as soon as one is available
+     * \return frame; nullptr if the source was stopped
+     */
+    std::shared_ptr<const CameraFrame> WaitFrame(unsigned long long sequence);
+
+    /**
+     * \brief Return the sequence number of the newest frame (0 if no frame was received yet).
+     */
+    unsigned long long LatestSequence();
+
+    /**
+     * \brief Return the name of the connected robot port.
+     */
+    const std::string &GetRobotPort() const { return robot_port; }
+
+ private:
+    CameraSource(const std::string &robot_port, const std::string &port_name, const std::string &carrier);
+
+    /** registry of the active sources -> key: robot port name **/
+    static std::mutex registry_mutex;
+    static std::map<std::string, std::weak_ptr<CameraSource>> registry;
+
+    std::string robot_port;                                                   // robot camera port name
+    std::string carrier;                                                      // YARP carrier of the connection
+    yarp::os::BufferedPort<yarp::sig::ImageOf<yarp::sig::PixelRgb>> port;    // local receiving port
+    std::thread receive_thread;                                               // thread receiving the frames
+    std::atomic<bool> running{false};                                         // flag to stop the receiving thread
+
+    std::mutex frame_mutex;                   // protects the newest frame
+    std::condition_variable frame_cond;       // signals a new frame
+    std::shared_ptr<CameraFrame> latest;      // newest frame
+
+    // frames for reuse; the last owner of a handed out frame returns it -> outlives the source while readers hold frames
+    struct FramePool {
+        std::mutex mutex;                                  // protects the free list
+        std::vector<std::unique_ptr<CameraFrame>> free;    // frames, which are not referenced by the source or any reader
+    };
+    std::shared_ptr<FramePool> frame_pool = std::make_shared<FramePool>();
+
+    // receive the frames and publish them as newest frame
+    void ReceiveLoop();
+    // return a frame from the free list for the next image; the frame returns to the free list, when the last owner releases it
+    std::shared_ptr<CameraFrame> FreeFrame();
+    // stop the receiving thread and wake up the waiting readers
+    void Stop();
+};
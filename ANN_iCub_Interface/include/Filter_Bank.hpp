@@ -0,0 +1,92 @@
+/*
+ *  Copyright (C) 2019-2024 Torsten Fietzek
+ *
+ *  Filter_Bank.hpp is part of the ANNarchy iCub interface
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  The ANNarchy iCub interface is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this headers. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <opencv2/opencv.hpp>
+#include <vector>
+
+#include "Image_Processor.hpp"
+#include "Thread_Pool.hpp"
+
+/**
+ * \brief V1-like filter bank applied to the processed gray images of the Visual Reader: oriented Gabor filters or ON/OFF difference-of-Gaussians.
+ *        The kernels are computed once; the filter responses are written as one contiguous (filters x height x width) block.
+ */
+class FilterBank {
+ public:
+    FilterBank() = default;
+
+    /**
+     * \brief Compute a bank of oriented Gabor kernels (zero mean, L1-normalized -> responses in [-1, 1] for images in [0, 1]).
+     * \param[in] orientations number of orientations, equally spaced in [0°, 180°)
+     * \param[in] wavelengths wavelengths of the sinusoidal carrier in pixel (one scale per wavelength)
+     * \param[in] phases phase offsets of the carrier in degree (0: even/symmetric; 90: odd/antisymmetric)
+     * \return True, if the parameters are valid.
+     */
+    bool InitGabor(int orientations, const std::vector<double> &wavelengths, const std::vector<double> &phases);
+
+    /**
+     * \brief Set up a bank of ON/OFF difference-of-Gaussians (separable Gaussian filtering); each scale yields an ON and an OFF map.
+     * \param[in] sigmas standard deviations of the center Gaussians in pixel (one scale per sigma)
+     * \param[in] surround_ratio ratio of the surround and the center standard deviation (> 1)
+     * \return True, if the parameters are valid.
+     */
+    bool InitDoG(const std::vector<double> &sigmas, double surround_ratio);
+
+    /**
+     * \brief Remove all filters.
+     */
+    void Clear();
+
+    /**
+     * \brief Return the number of filter response maps.
+     */
+    int Count() const { return n_maps; }
+
+    /**
+     * \brief Apply the filter bank to the image; the filters are distributed on the worker pool.
+     * \param[in] image single channel image (CV_32F)
+     * \param[out] out output buffer for Count() x image height x image width elements of the given type; uint8 stores Gabor responses
+     *             offset to 127.5 * (1 + r) (zero response -> 127.5) and DoG responses scaled by 255
+     * \param[in] dtype element type of the output buffer
+     * \param[in] pool worker pool for the filters; nullptr to apply the filters sequentially
+     */
+    void Apply(const cv::Mat &image, uint8_t *out, ImageDType dtype, ThreadPool *pool);
+
+ private:
+    // single filter of the bank, writing one (Gabor) or two (DoG: ON, OFF) response maps
+    struct Filter {
+        cv::Mat kernel;              // Gabor kernel (CV_32F); empty for DoG filters
+        double sigma_center = 0.;    // DoG center standard deviation
+        double sigma_surround = 0.;  // DoG surround standard deviation
+        int map_idx = 0;             // index of the first response map in the output
+        cv::Mat response;            // filter response (CV_32F), reused over the frames
+        cv::Mat surround;            // DoG surround response (CV_32F), reused over the frames
+    };
+
+    std::vector<Filter> filters;    // filters of the bank
+    int n_maps = 0;                 // number of response maps
+
+    // apply a single filter and write its response map(s) into the output buffer
+    void ApplyFilter(Filter &filter, const cv::Mat &image, uint8_t *out, ImageDType dtype);
+    // convert a response map (CV_32F) into the output map of the given type; signed maps are offset into the uint8 range
+    void StoreMap(const cv::Mat &response, uint8_t *out, int map_idx, ImageDType dtype, bool signed_map);
+};
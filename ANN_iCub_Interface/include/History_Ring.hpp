@@ -0,0 +1,157 @@
+/*
+ *  Copyright (C) 2019-2024 Torsten Fietzek
+ *
+ *  History_Ring.hpp is part of the ANNarchy iCub interface
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  The ANNarchy iCub interface is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this headers. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include <thread>
+
+/**
+ * \brief Preallocated ring buffer of the last samples (fixed number of double values with a timestamp); one writer thread, any number of readers.
+ *        The ring holds twice the history length, so the writer never waits; a reader retries only if the writer lapped the copied samples.
+ */
+class HistoryRing {
+ public:
+    HistoryRing() = default;
+
+    HistoryRing(const HistoryRing &) = delete;
+    HistoryRing &operator=(const HistoryRing &) = delete;
+
+    /**
+     * \brief Allocate the ring; not thread safe -> call before the writer is started.
+     * \param[in] length number of samples, which can be read at once
+     * \param[in] size number of values per sample
+     */
+    void Resize(size_t length, size_t size) {
+        capacity = 2 * length;
+        n_values = size;
+        history = length;
+        values.reset(new std::atomic<double>[capacity * size]);
+        times.reset(new std::atomic<double>[capacity]);
+        for (size_t i = 0; i < capacity * size; i++) {
+            values[i].store(0., std::memory_order_relaxed);
+        }
+        for (size_t i = 0; i < capacity; i++) {
+            times[i].store(0., std::memory_order_relaxed);
+        }
+        head.store(0, std::memory_order_release);
+    }
+
+    /**
+     * \brief Return the number of samples, which can be read at once.
+     */
+    size_t Length() const { return history; }
+
+    /**
+     * \brief Return the number of values per sample.
+     */
+    size_t Size() const { return n_values; }
+
+    /**
+     * \brief Append a sample; the oldest sample is dropped (writer thread only).
+     * \param[in] data Size() values of the sample
+     * \param[in] time timestamp of the sample
+     */
+    void Write(const double *data, double time) {
+        auto count = head.load(std::memory_order_relaxed);
+        size_t slot = count % capacity;
+        for (size_t i = 0; i < n_values; i++) {
+            values[slot * n_values + i].store(data[i], std::memory_order_relaxed);
+        }
+        times[slot].store(time, std::memory_order_relaxed);
+        head.store(count + 1, std::memory_order_release);
+    }
+
+    /**
+     * \brief Copy the newest samples, oldest first.
+     * \param[out] data output array for n x Size() values
+     * \param[out] stamps output array for n timestamps; nullptr -> no timestamps
+     * \param[in] n number of samples; n <= Length()
+     * \return number of copied samples; less than n while fewer samples were written
+     */
+    size_t ReadLast(double *data, double *stamps, size_t n) const {
+        unsigned long long h0, h1;
+        size_t count;
+        do {
+            h0 = head.load(std::memory_order_acquire);
+            count = (h0 < n) ? static_cast<size_t>(h0) : n;
+            Copy(h0 - count, count, data, stamps);
+            std::atomic_thread_fence(std::memory_order_acquire);
+            h1 = head.load(std::memory_order_relaxed);
+        } while (!Valid(h0, h1, count));
+        return count;
+    }
+
+    /**
+     * \brief Copy the samples newer than the given time, oldest first; at most Length() samples.
+     * \param[out] data output array for Length() x Size() values
+     * \param[out] stamps output array for Length() timestamps; nullptr -> no timestamps
+     * \param[in] since time limit; samples with a timestamp > since are copied
+     * \return number of copied samples
+     */
+    size_t ReadSince(double *data, double *stamps, double since) const {
+        unsigned long long h0, h1;
+        size_t count, available;
+        do {
+            h0 = head.load(std::memory_order_acquire);
+            // the timestamps increase -> search backwards from the newest sample
+            available = (h0 < history) ? static_cast<size_t>(h0) : history;
+            count = 0;
+            while (count < available && times[(h0 - count - 1) % capacity].load(std::memory_order_relaxed) > since) {
+                count++;
+            }
+            Copy(h0 - count, count, data, stamps);
+            std::atomic_thread_fence(std::memory_order_acquire);
+            h1 = head.load(std::memory_order_relaxed);
+        } while (!Valid(h0, h1, available));
+        return count;
+    }
+
+ private:
+    std::atomic<unsigned long long> head{0};          // number of written samples
+    std::unique_ptr<std::atomic<double>[]> values;    // sample values, capacity x n_values
+    std::unique_ptr<std::atomic<double>[]> times;     // sample timestamps
+    size_t capacity = 0;                              // number of samples in the ring
+    size_t history = 0;                               // number of samples, which can be read at once
+    size_t n_values = 0;                              // number of values per sample
+
+    // copy count samples, starting with the sample number first
+    void Copy(unsigned long long first, size_t count, double *data, double *stamps) const {
+        for (size_t k = 0; k < count; k++) {
+            size_t slot = (first + k) % capacity;
+            for (size_t i = 0; i < n_values; i++) {
+                data[k * n_values + i] = values[slot * n_values + i].load(std::memory_order_relaxed);
+            }
+            if (stamps != nullptr) {
+                stamps[k] = times[slot].load(std::memory_order_relaxed);
+            }
+        }
+    }
+
+    // check if the newest count samples at head h0 were not overwritten until head h1 (the writer may be writing sample h1)
+    bool Valid(unsigned long long h0, unsigned long long h1, size_t count) const {
+        if (h1 - h0 < capacity - count) {
+            return true;
+        }
+        std::this_thread::yield();
+        return false;
+    }
+};
@@ -0,0 +1,243 @@
+/*
+ *  Copyright (C) 2019-2024 Torsten Fietzek
+ *
+ *  Image_Processor.hpp is part of the ANNarchy iCub interface
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  The ANNarchy iCub interface is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this headers. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <opencv2/opencv.hpp>
+#include <string>
+#include <vector>
+
+/**
+ * \brief Sampling layout of the processed images.
+ */
+enum class ImageLayout : int {
+    CARTESIAN = 0,    // rectangular pixel grid: out_height x out_width
+    LOG_POLAR = 1     // foveated retina: rings x wedges
+};
+
+/**
+ * \brief Element type of the processed images.
+ */
+enum class ImageDType : int {
+    UINT8 = 0,      // 8 bit unsigned integer, [0, 255]
+    FLOAT16 = 1,    // half precision, [0., 1.]
+    FLOAT32 = 2,    // single precision, [0., 1.]
+    FLOAT64 = 3     // double precision, [0., 1.]
+};
+
+/**
+ * \brief Return the element type for the given name (uint8, float16, float32, float64).
+ * \param[in] name name of the element type
+ * \param[out] dtype element type
+ * \return True, if the name is valid.
+ */
+bool ParseImageDType(const std::string &name, ImageDType &dtype);
+
+/**
+ * \brief Return the size of one element of the given type in bytes.
+ */
+size_t ImageDTypeSize(ImageDType dtype);
+
+/**
+ * \brief Return the OpenCV depth (CV_8U, CV_16F, CV_32F, CV_64F) of the given element type.
+ */
+int ImageDTypeDepth(ImageDType dtype);
+
+/**
+ * \brief Preprocessing of the RGB camera images (color conversion, cropping, scaling and normalization) for the Visual Reader.
+ *        The image is processed in one pass with resampling tables, which are computed once for the selected geometry.
+ */
+class ImageProcessor {
+ public:
+    ImageProcessor() = default;
+
+    /**
+     * \brief Compute the resampling tables for the given image geometry.
+     * \param[in] in_width input image width in pixel
+     * \param[in] in_height input image height in pixel
+     * \param[in] rov region of view in the input image, which is scaled to the output image
+     * \param[in] out_width output image width in pixel
+     * \param[in] out_height output image height in pixel
+     * \param[in] gray True for grayscale output; False for BGR output
+     * \param[in] filter OpenCV interpolation flag used for upscaling (cv::INTER_LINEAR or cv::INTER_CUBIC); like ProcessStaged, cv::INTER_AREA
+     *                   is used if any axis is downscaled
+     * \return True, if the geometry is valid.
+     */
+    bool Init(int in_width, int in_height, cv::Rect rov, int out_width, int out_height, bool gray, int filter);
+
+    /**
+     * \brief Compute the remap table for the log-polar retina layout. The ROV is sampled on rings around its center:
+     *        rings inside the fovea radius are spaced linearly, the outer rings logarithmically up to the inscribed circle of the ROV.
+     * \param[in] in_width input image width in pixel
+     * \param[in] in_height input image height in pixel
+     * \param[in] rov region of view in the input image, which is mapped onto the retina
+     * \param[in] rings number of rings -> output image height
+     * \param[in] wedges number of wedges -> output image width
+     * \param[in] fovea_radius radius of the linearly sampled fovea in input pixel
+     * \param[in] gray True for grayscale output; False for BGR output
+     * \return True, if the geometry is valid.
+     */
+    bool InitLogPolar(int in_width, int in_height, cv::Rect rov, int rings, int wedges, double fovea_radius, bool gray);
+
+    /**
+     * \brief Move the region of view and recompute the resampling/remap tables for the initialized layout, output size and channels.
+     *        The tables are replaced in place, thus the call must not overlap with processing calls of this processor.
+     * \param[in] rov new region of view in the input image
+     * \return True, if the geometry is valid. Otherwise the previous region of view is kept.
+     */
+    bool SetRegionOfView(cv::Rect rov);
+
+    /**
+     * \brief Enable the lens undistortion; the undistortion is fused with the crop and the scaling into one remap table.
+     *        For the cartesian layout the single pass resampling is replaced by the remap (bilinear sampling of the distorted image).
+     * \param[in] intrinsics camera intrinsics in input pixel -> fx, fy, cx, cy
+     * \param[in] distortion distortion coefficients of the pinhole model -> k1, k2, p1, p2, k3
+     * \return True, if the calibration is valid.
+     */
+    bool SetUndistortion(const std::vector<double> &intrinsics, const std::vector<double> &distortion);
+
+    /**
+     * \brief Process the RGB image in a single pass and write the image with the given element type into the output buffer.
+     * \param[in] rgb interleaved RGB image data
+     * \param[in] width width of the given image; has to match the initialized input width
+     * \param[in] height height of the given image; has to match the initialized input height
+     * \param[in] row_step number of bytes per image row
+     * \param[out] out output buffer with space for GetOutputSize() elements of the given type
+     * \param[in] dtype element type of the output buffer
+     * \return True, if successful. False, if the image size does not match the initialized geometry.
+     */
+    bool Process(const uint8_t *rgb, int width, int height, size_t row_step, void *out, ImageDType dtype);
+
+    /**
+     * \brief Process the RGB image with the multi-stage OpenCV pipeline and write the image with the given element type into the output buffer.
+     * \param[in] rgb interleaved RGB image data
+     * \param[in] width width of the given image
+     * \param[in] height height of the given image
+     * \param[in] row_step number of bytes per image row
+     * \param[out] out output buffer with space for GetOutputSize() elements of the given type
+     * \param[in] dtype element type of the output buffer
+     */
+    void ProcessStaged(const uint8_t *rgb, int width, int height, size_t row_step, void *out, ImageDType dtype);
+
+    /**
+     * \brief Process the RGB image in a single pass and write the image into the output buffer; the conversion to the element type
+     *        is part of the pass -> uint8_t: [0, 255]; cv::float16_t, float, double: normalized [0., 1.]. The gray conversion is bit exact
+     *        to cv::cvtColor, the resampled values are clamped to [0, 255] (bicubic overshoot) and not rounded in between; the output differs
+     *        from ProcessStaged by at most one 8 bit step (1 or 1/255).
+     * \param[in] rgb interleaved RGB image data
+     * \param[in] width width of the given image; has to match the initialized input width
+     * \param[in] height height of the given image; has to match the initialized input height
+     * \param[in] row_step number of bytes per image row
+     * \param[out] out output buffer with space for GetOutputSize() elements
+     * \return True, if successful. False, if the image size does not match the initialized geometry.
+     */
+    template <typename T>
+    bool Process(const uint8_t *rgb, int width, int height, size_t row_step, T *out);
+
+    /**
+     * \brief Process the RGB image with the multi-stage OpenCV pipeline (cvtColor, crop, resize, convertTo) -> reference implementation.
+     * \param[in] rgb interleaved RGB image data
+     * \param[in] width width of the given image
+     * \param[in] height height of the given image
+     * \param[in] row_step number of bytes per image row
+     * \param[out] out output buffer with space for GetOutputSize() elements
+     */
+    template <typename T>
+    void ProcessStaged(const uint8_t *rgb, int width, int height, size_t row_step, T *out);
+
+    /**
+     * \brief Return the number of elements of the flattened output image.
+     */
+    size_t GetOutputSize() const { return static_cast<size_t>(out_width) * out_height * out_channels; }
+
+    /**
+     * \brief Return the shape of the output image -> height (rings), width (wedges), channels.
+     */
+    std::vector<int> GetOutputShape() const { return {out_height, out_width, out_channels}; }
+
+    /**
+     * \brief Return the sampling layout of the output image.
+     */
+    ImageLayout GetLayout() const { return layout; }
+
+ private:
+    /** resampling method of both axes, selected like cv::resize in the staged pipeline **/
+    enum class Resampling {
+        AREA,           // INTER_AREA, no axis upscaled -> area averaging
+        AREA_LINEAR,    // INTER_AREA, one axis upscaled -> bilinear interpolation with the pixel area relation of OpenCV
+        LINEAR,         // no axis downscaled, bilinear interpolation
+        CUBIC           // no axis downscaled, bicubic interpolation
+    };
+
+    /** resampling table for one image axis; fixed number of taps per output pixel **/
+    struct ResampleTable {
+        int taps = 0;                  // number of source pixels per output pixel
+        std::vector<int> index;        // source pixel indices (out_size x taps)
+        std::vector<float> weight;     // source pixel weights (out_size x taps)
+    };
+
+    /** geometry **/
+    int in_width = 0, in_height = 0;      // input image size in pixel
+    cv::Rect rov;                         // region of view in the input image
+    int out_width = 0, out_height = 0;    // output image size in pixel
+    int out_channels = 1;                 // output channel count (gray: 1; BGR: 3)
+    int filter = cv::INTER_LINEAR;        // interpolation flag for upscaling
+    double fovea_radius = 0.;             // radius of the linearly sampled fovea in input pixel (log-polar layout)
+
+    /** lens undistortion **/
+    bool undistort = false;               // flag, being true if the undistortion is part of the remap table
+    std::vector<double> intrinsics;       // camera intrinsics -> fx, fy, cx, cy
+    std::vector<double> distortion;       // distortion coefficients -> k1, k2, p1, p2, k3
+    ImageLayout layout = ImageLayout::CARTESIAN;    // sampling layout of the output image
+    static constexpr float norm_fact = 1.f / 255.f;    // normalization factor
+
+    /** resampling data **/
+    ResampleTable table_x, table_y;    // horizontal and vertical resampling tables
+    std::vector<int> gather_index;     // horizontal table expanded to the output row elements (taps x out_width * out_channels), index into color_row
+    std::vector<float> gather_weight;  // weights of the expanded horizontal table (taps x out_width * out_channels)
+    std::vector<float> color_row;      // color converted source row within the region of view (gray: 1; RGB: 3 values per pixel)
+    int cache_slots = 0;               // number of cached horizontally resampled rows
+    std::vector<float> row_cache;      // horizontally resampled source rows
+    std::vector<int> row_tag;          // source row index stored in the respective cache slot
+    std::vector<float> acc_row;        // accumulator for one output row
+
+    // scale factor of the OpenCV conversion to the output element type
+    template <typename T>
+    double StoreScale() const;
+
+    /** matrices for the multi-stage pipeline **/
+    cv::Mat color_mat, scaled_mat;
+
+    /** remap sampling (log-polar retina; undistortion) **/
+    cv::Mat remap_map1, remap_map2;    // fixed point remap table from output samples to input pixel positions
+    cv::Mat remap_mat;                 // sampled RGB image
+
+    // compute the resampling table for one axis
+    static ResampleTable ComputeTable(int rov_size, int out_size, int offset, Resampling method);
+    // sample the image with the precomputed remap table (retina or undistorted image) and write the normalized result into the output buffer
+    template <typename T>
+    bool ProcessRemap(const uint8_t *rgb, int width, int height, size_t row_step, T *out);
+    // apply the lens distortion to the sample positions (if enabled) and convert them into the fixed point remap table
+    void BuildRemap(cv::Mat &map_x, cv::Mat &map_y);
+    // return true, if the output is sampled with the remap table instead of the resampling tables
+    bool UseRemap() const { return layout == ImageLayout::LOG_POLAR || undistort; }
+    // return the horizontally resampled (and color converted) source row, computed on demand
+    const float *ResampleRow(const uint8_t *src_row, int row);
+};
@@ -20,18 +20,62 @@
 #pragma once
 
 #include <yarp/dev/all.h>
+#include <yarp/dev/impl/jointData.h>
+#include <yarp/os/all.h>
 #include <yarp/sig/all.h>
 
+#include <atomic>
+#include <chrono>
+#include <cstdint>
 #include <map>
+#include <memory>
+#include <mutex>
 #include <string>
 #include <thread>
 #include <vector>
 
+#include "History_Ring.hpp"
 #include "Module_Base_Class.hpp"
+#include "Seq_Lock.hpp"
 #ifdef _USE_GRPC
 #include "ProvideInputServer.h"
 #endif
 
+/**
+ * \brief Population coding of the joint angles.
+ */
+enum class PopCoding : int {
+    GAUSSIAN = 0,       // Gaussian bump around the joint angle (not normalized, peak 1)
+    VON_MISES = 1,      // circular bump for wrap-around joints; period 360 degree, concentration 1 / sigma^2 (sigma in radian)
+    THERMOMETER = 2     // all neurons up to the joint angle are active (1), the others 0
+};
+
+/**
+ * \brief Return the population coding for the given name (gaussian, von_mises, thermometer).
+ * \param[in] name name of the population coding
+ * \param[out] coding population coding
+ * \return True, if the name is valid.
+ */
+bool ParsePopCoding(const std::string &name, PopCoding &coding);
+
+/**
+ * \brief Receiver for the joint state stream of a control board (stateExt:o); publishes the positions, velocities and accelerations
+ *        of every state message as one sample into a sequence lock.
+ */
+class JointStateCallback : public yarp::os::TypedReaderCallback<yarp::dev::impl::jointData> {
+ public:
+    JointStateCallback(yarp::os::BufferedPort<yarp::dev::impl::jointData> &port, SeqLock &state, int joints);
+
+    // decode a state message -> called by the port thread
+    void onRead(yarp::dev::impl::jointData &data) override;
+
+ private:
+    yarp::os::BufferedPort<yarp::dev::impl::jointData> &port;    // receiving port, source of the message envelope
+    SeqLock &state;                                               // sample: positions, velocities, accelerations
+    int joints;                                                   // number of joints
+    std::vector<double> sample;                                   // decoded state message
+};
+
 /**
  * \brief  Read-out of the joint angles of the iCub robot
  */
@@ -51,12 +95,14 @@ class JointReader : public Mod_BaseClass {
      * \param[in] pop_n Number of neurons per population, encoding each one joint angle; only works if parameter "deg_per_neuron" is not set
      * \param[in] deg_per_neuron (default = 0.0) degree per neuron in the populations, encoding the joints angles; if set: population size depends on joint working range
      * \param[in] ini_path Path to the "interface_param.ini"-file.
+     * \param[in] carrier (default = "") YARP carrier for the robot connections, e.g. tcp, fast_tcp, shmem, udp; empty: carrier option of the ini file
+     * \param[in] coding (default = "gaussian") population coding of the joint angles: gaussian, von_mises (wrap-around joints) or thermometer
      * \return True, if the initializatiion was successful. False if an error occured. Additionally, an error message is written to the error stream (cerr).\n
      *          Typical errors:
      *              - arguments not valid: e.g. part string not correct or ini file not in given path \n
      *              - YARP-Server not running
      */
-    bool Init(std::string part, double sigma, unsigned int pop_n, double deg_per_neuron, std::string ini_path);
+    bool Init(std::string part, double sigma, unsigned int pop_n, double deg_per_neuron, std::string ini_path, std::string carrier = "", std::string coding = "gaussian");
 
     /**
      * \brief Initialize the joint reader with given parameters
@@ -67,19 +113,92 @@ class JointReader : public Mod_BaseClass {
      * \param[in] ini_path Path to the "interface_param.ini"-file.
      * \param[in] ip_address gRPC server ip address -> has to match ip address of the JointReadOut-Population
      * \param[in] port gRPC server port -> has to match port of the JointReadOut-Population
+     * \param[in] carrier (default = "") YARP carrier for the robot connections, e.g. tcp, fast_tcp, shmem, udp; empty: carrier option of the ini file
+     * \param[in] coding (default = "gaussian") population coding of the joint angles: gaussian, von_mises (wrap-around joints) or thermometer
      * \return True, if the initializatiion was successful. False if an error occured. Additionally, an error message is written to the error stream (cerr).\n
      *          Typical errors:
      *              - arguments not valid: e.g. part string not correct or ini file not in given path \n
      *              - YARP-Server not running
      */
     bool InitGRPC(std::string part, double sigma, unsigned int pop_n, double deg_per_neuron, std::string ini_path, std::string ip_address,
-                  unsigned int port);
+                  unsigned int port, std::string carrier = "", std::string coding = "gaussian");
 
     /**
      * \brief  Close joint reader with cleanup
      */
     void Close() override;
 
+    /**
+     * \brief Select the sampling mode. In the threaded mode a sampler thread polls the joint encoders with the given rate and all readings return
+     *        the newest sample without a request to the robot; the timestamps of the *Time readings are the sample times.
+     * \param[in] threaded true: background sampling; false: every reading requests the joint angles from the robot (default)
+     * \param[in] rate (default = 1000.) sampling rate in Hz of the background sampling
+     * \return True, if the sampling mode was set successfully.
+     */
+    bool SetSamplingMode(bool threaded, double rate = 1000.);
+
+    /**
+     * \brief Select the streaming mode. In the streaming mode the reader subscribes to the joint state stream of the control board (stateExt:o);
+     *        all readings return the newest received state without a request to the robot and the *Time readings return the message timestamps.
+     * \param[in] streaming true: receive the joint state stream; false: read the joints through the control board device (default)
+     * \return True, if the streaming mode was set successfully. False, e.g. if the state port is not available or no state message arrived within one second.
+     */
+    bool SetStreamingMode(bool streaming);
+
+    /**
+     * \brief Keep the history of the joint angles in a preallocated ring buffer, filled by the sampler thread; enables the sampling mode with the given rate.
+     *        Switching the sampling mode off stops the recording, the recorded samples stay readable.
+     * \param[in] length number of samples in the history; 0 -> no history (the sampling mode stays as it is)
+     * \param[in] rate (default = 1000.) sampling rate in Hz of the history
+     * \return True, if successful.
+     */
+    bool SetHistory(unsigned int length, double rate = 1000.);
+
+    /**
+     * \brief Return the number of samples in the history; 0 if no history is recorded.
+     */
+    unsigned int GetHistoryLength();
+
+    /**
+     * \brief Copy the last n samples of the history into preallocated buffers, oldest sample first, without memory allocation.
+     * \param[in] n number of samples; n <= GetHistoryLength()
+     * \param[out] buffer output buffer for n x joints angles in degree
+     * \param[out] timestamps output buffer for n sample timestamps in seconds; nullptr -> no timestamps
+     * \param[in] size number of elements of the angle buffer
+     * \return Number of copied samples (less than n while fewer samples were recorded); -1 at error.
+     */
+    int ReadHistoryLastInto(unsigned int n, double *buffer, double *timestamps, size_t size);
+
+    /**
+     * \brief Copy the samples of the history newer than the given time into preallocated buffers, oldest sample first, without memory allocation.
+     * \param[in] since time limit in seconds (timestamp of the sample clock); samples with a timestamp > since are copied
+     * \param[out] buffer output buffer for GetHistoryLength() x joints angles in degree
+     * \param[out] timestamps output buffer for GetHistoryLength() sample timestamps in seconds; nullptr -> no timestamps
+     * \param[in] size number of elements of the angle buffer
+     * \return Number of copied samples; -1 at error.
+     */
+    int ReadHistorySinceInto(double since, double *buffer, double *timestamps, size_t size);
+
+    /**
+     * \brief Read the joint state of all joints: joint angles, velocities and accelerations from one request (IEncodersTimed, getEncoderSpeeds,
+     *        getEncoderAccelerations) or from the newest sample in the sampling/streaming mode.
+     * \param[out] positions output array for the joint angles of all joints in degree
+     * \param[out] velocities output array for the joint velocities of all joints in degree/s
+     * \param[out] accelerations output array for the joint accelerations of all joints in degree/s^2
+     * \param[out] timestamp timestamp of the state in seconds; newest robot-side timestamp of the joints
+     * \return True, if successful.
+     */
+    bool ReadStateAll(double *positions, double *velocities, double *accelerations, double *timestamp);
+
+    /**
+     * \brief Read the joint state of all joints into one contiguous buffer with the rows timestamps, joint angles, velocities and accelerations.
+     * \param[out] buffer output buffer for 4 x joints values: robot-side timestamp per joint in seconds, angles in degree, velocities in degree/s
+     *             and accelerations in degree/s^2; in the sampling/streaming mode all joints carry the sample timestamp
+     * \param[in] size number of elements of the buffer
+     * \return True, if successful. False if the reader is not initialized or the buffer size does not match.
+     */
+    bool ReadStateAllInto(double *buffer, size_t size);
+
     /**
      * \brief  Return number of controlled joints
      * \return Number of joints, being controlled by the reader
@@ -98,6 +217,52 @@ class JointReader : public Mod_BaseClass {
      */
     std::vector<unsigned int> GetNeuronsPerJoint();
 
+    /**
+     * \brief Return the size of the largest population -> row length of the buffer of ReadPopAllInto
+     * \return Maximum number of neurons per joint.
+     */
+    unsigned int GetMaxNeuronsPerJoint();
+
+    /**
+     * \brief Restrict the population coding to the neurons within cutoff * sigma of the joint angle; the other neurons are set to zero without evaluation.
+     *        Only available for the Gaussian coding; the other codings always evaluate the whole population.
+     * \param[in] cutoff half width of the encoding window in multiples of sigma (> 0); 0 restores the default window of 8 sigma
+     * \return True, if the cutoff is valid.
+     */
+    bool SetSparseCutoff(double cutoff);
+
+    /**
+     * \brief Return the maximum number of neurons within the encoding window -> row length of the value buffer of ReadPopAllSparseInto
+     * \return Maximum number of encoded neurons per joint.
+     */
+    unsigned int GetSparseWidth();
+
+    /**
+     * \brief Set the deadbands of the joints for the change detection: a joint counts as changed, if its angle moved more than its deadband since it was
+     *        last reported as changed to the same consumer (ReadChangedMaskInto, every changed-only gRPC client). The plain readings do not consume
+     *        changes. With the population cache, the population readings of all joints return the cached population of the last held angle for
+     *        joints within their deadband instead of encoding the new angle.
+     * \param[in] deadband deadband in degree; one value for all joints or one value per joint; empty -> no deadband, every movement counts
+     * \param[in] cache_pop (default = false) reuse the cached population of unchanged joints
+     * \return True, if successful. False if the reader is not initialized or the deadbands are not valid.
+     */
+    bool SetDeadband(std::vector<double> deadband, bool cache_pop = false);
+
+    /**
+     * \brief Return the deadbands of the joints.
+     * \return Deadband in degree per joint.
+     */
+    std::vector<double> GetDeadband();
+
+    /**
+     * \brief Read all joints and write the changed mask into a preallocated buffer: the joints, which moved beyond their deadband since they were
+     *        last reported by this method. Independent of the other readings and of the changed-only gRPC readout.
+     * \param[out] mask output buffer for one value per joint: 1 if the joint moved beyond its deadband, otherwise 0
+     * \param[in] size number of elements of the buffer
+     * \return Number of changed joints; -1 at error, e.g. the reader is not initialized or the buffer size does not match.
+     */
+    int ReadChangedMaskInto(uint8_t *mask, size_t size);
+
     /**
      * \brief Read all joints and return joint angles directly in degree as double values
      * \return Joint angles, read from the robot in degree.
@@ -105,6 +270,14 @@ class JointReader : public Mod_BaseClass {
     std::vector<double> ReadDoubleAll();
     std::vector<double> ReadDoubleAllTime();
 
+    /**
+     * \brief Read all joints and write the joint angles in degree into a preallocated buffer, without memory allocation.
+     * \param[out] buffer output buffer for GetJointCount() values
+     * \param[in] size number of elements of the buffer
+     * \return True, if successful. False if the reader is not initialized or the buffer size does not match.
+     */
+    bool ReadDoubleAllInto(double *buffer, size_t size);
+
     /**
      * \brief Read multiple joints and return joint angles directly in degree as double values
      * \param[in] joint_select Joint number selection of the robot part
@@ -127,6 +300,37 @@ class JointReader : public Mod_BaseClass {
      */
     std::vector<std::vector<double>> ReadPopAll();
 
+    /**
+     * \brief Read all joints and write the joint angles encoded in populations into a preallocated buffer, without memory allocation.
+     * \param[out] buffer output buffer for joints x row_size values; the rows of joints with smaller populations are zero padded
+     * \param[in] size number of elements of the buffer
+     * \param[in] row_size (default = 0) number of values per joint row, at least GetMaxNeuronsPerJoint(); 0 -> GetMaxNeuronsPerJoint()
+     * \return True, if successful. False if the reader is not initialized or the buffer size does not match.
+     */
+    bool ReadPopAllInto(double *buffer, size_t size, unsigned int row_size = 0);
+
+    /**
+     * \brief Read all joints and write the sparse population code: per joint the index of the first neuron within the encoding window and the window values.
+     * \param[out] start index of the first encoded neuron in the joint population, one value per joint
+     * \param[out] count number of encoded neurons, one value per joint
+     * \param[out] values output buffer for joints x GetSparseWidth() values; row j holds count[j] values for the neurons start[j] ... start[j] + count[j] - 1
+     * \param[in] size number of elements of the value buffer
+     * \return True, if successful. False if the reader is not initialized, the buffer size does not match or an encoding window exceeds the sparse width
+     *         (the windows are never truncated).
+     */
+    bool ReadPopAllSparseInto(int *start, int *count, double *values, size_t size);
+
+    /**
+     * \brief Read all joints and draw one time step of Poisson spike trains from the population code: neuron i spikes with the probability
+     *        rate_i * max_rate * dt, with the population code rate_i in [0, 1]. Per calling thread a xorshift generator is used.
+     * \param[out] indices output buffer for the indices of the spiking neurons in the (joints x GetMaxNeuronsPerJoint()) population array, in ascending order
+     * \param[in] size number of elements of the index buffer; joints x GetMaxNeuronsPerJoint() covers every possible outcome
+     * \param[in] max_rate firing rate in Hz of a neuron with the population code value 1
+     * \param[in] dt length of the time step in seconds
+     * \return Number of spiking neurons; -1 at error, e.g. the reader is not initialized or the buffer is too small.
+     */
+    int ReadPopAllSpikesInto(int *indices, size_t size, double max_rate, double dt);
+
     /**
      * \brief Read multiple joints and return the joint angles encoded in populations.
      * \param[in] joint_select Joint number selection of the robot part
@@ -146,6 +350,9 @@ class JointReader : public Mod_BaseClass {
     std::vector<double> provideData(int value, bool enc);
     std::vector<double> provideData(std::vector<int> value, bool enc);
     std::vector<double> provideData(bool enc);
+    std::vector<double> provideSparseData(std::vector<int> &start, std::vector<int> &count);
+    std::vector<double> provideChangedData(uint64_t consumer, bool enc, bool sparse, bool resync, std::vector<int> &joint, std::vector<int> &start,
+                                           std::vector<int> &count);
 #endif
 
  private:
@@ -156,17 +363,63 @@ class JointReader : public Mod_BaseClass {
     std::vector<double> joint_deg_res;    // degree per neuron for the population coding, value per joint
     int joints = 0;                       // number of joints
     double sigma_pop;                     // sigma for Gaussian envelope in the population coding
+    unsigned int max_neurons = 0;         // size of the largest population
+    double sparse_cutoff = 0.;            // half width of the encoding window in sigma; 0 -> lut_cutoff
+    PopCoding coding = PopCoding::GAUSSIAN;    // population coding of the joint angles
 
     std::vector<double> joint_min;                  // minimum possible joint angles
     std::vector<double> joint_max;                  // maximum possible joint angles
     std::vector<std::vector<double>> neuron_deg;    // vector of vectors representing the degree values for the neuron populations
+    std::vector<double> angles_buffer;              // joint angles of the last encoder read, reused by the population readings
+    std::mutex buffer_mutex;                        // serialises the population readings (caller and gRPC thread) on angles_buffer and the population cache
+
+    /*** lookup tables for the population coding ***/
+    static constexpr int lut_res = 256;       // table entries per sigma
+    static constexpr int lut_cutoff = 8;      // table range in sigma; beyond the envelope is set to zero
+    std::vector<double> von_mises_lut;        // von Mises envelope over the angular distance, lut_res entries per sigma; depends on sigma
+    std::vector<double> spike_rates;          // population code of one joint, reused by the spike readings
+
+    /*** change detection ***/
+    // change state of one consumer of the change detection
+    struct ChangeState {
+        std::vector<double> reported_angles;    // joint angles of the last change per joint; NaN -> not reported yet
+        std::vector<uint8_t> changed_mask;      // joints changed at the last update of this consumer
+        std::chrono::steady_clock::time_point last_poll;    // time of the last update (gRPC consumers)
+    };
+    static constexpr double changed_timeout = 60.;          // gRPC consumers not polled for this time in seconds are removed
+    std::vector<double> deadband;                           // deadband per joint in degree
+    ChangeState mask_changes;                               // consumer: ReadChangedMaskInto
+    ChangeState cache_changes;                              // held angles of the population cache
+    std::vector<double> pop_cache;                          // populations of the held angles, joints x max_neurons; empty -> no population cache
+    std::map<uint64_t, ChangeState> grpc_changes;           // consumers: changed-only gRPC clients, by consumer id
+    std::mutex changed_mutex;                               // guards the change states of the consumers
 
     /*** yarp data structures ***/
     yarp::sig::Vector joint_angles;     // yarp vector for reading all joint angles
     yarp::dev::PolyDriver driver;       // yarp driver needed for reading joint encoders
     yarp::dev::IEncoders *ienc;         // iCub joint encoder interface
+    yarp::dev::IEncodersTimed *ienc_timed = nullptr;    // iCub joint encoder interface with robot-side timestamps; nullptr if not provided
+    std::vector<double> joint_stamps;                   // robot-side timestamps of the last encoder read
     yarp::dev::IControlLimits *ilim;    // iCub joint limits interface
 
+    /*** background sampling ***/
+    SeqLock sample_lock;                  // newest joint angle sample of the sampler thread
+    HistoryRing history;                  // last joint angle samples of the sampler thread
+    std::thread sampler_thread;           // thread polling the joint encoders
+    std::atomic<bool> sampling{false};    // flag, being true while the sampler thread is running
+    double sample_period = 0.001;         // sampling period in seconds
+
+    /*** joint state stream ***/
+    yarp::os::BufferedPort<yarp::dev::impl::jointData> state_port;    // port receiving the control board state stream
+    std::unique_ptr<JointStateCallback> state_callback;               // decoder of the state messages
+    std::atomic<bool> streaming{false};                               // flag, being true while the state stream is received
+    std::vector<double> state_buffer;                                 // joint state: angles, velocities, accelerations
+
+    /*** connection parameters ***/
+    std::string robot_port_prefix;     // robot port name prefix
+    std::string client_port_prefix;    // client port name prefix
+    std::string carrier;               // YARP carrier of the robot connections
+
     /** grpc communication **/
 #ifdef _USE_GRPC
     std::string _ip_address = "";    // gRPC server ip address
@@ -178,8 +431,45 @@ class JointReader : public Mod_BaseClass {
     /*** auxilary functions ***/
     // check if iCub part key is valid
     bool CheckPartKey(std::string key);
+    // poll the joint encoders and publish the samples -> sampler thread
+    void SampleLoop();
+    // stop the sampler thread
+    void StopSampling();
+    // close the state stream
+    void StopStreaming();
+    // read all joint angles: newest sample in the sampling mode, otherwise requested from the robot
+    void ReadEncoders(double *angles, double *timestamp = nullptr);
+    // read one joint angle: newest sample in the sampling mode, otherwise requested from the robot
+    double ReadEncoder(int joint, double *timestamp = nullptr);
+    // read the joint state (angles, velocities, accelerations) and the per joint timestamps from the control board device; one attempt
+    bool ReadDeviceState(double *state, double *stamps, double &time);
+    // read the joint state: newest sample in the sampling or streaming mode, otherwise requested from the robot
+    void ReadState(double *state, double *stamps);
+    // compare the joint angles of a reading of all joints with the reported angles of a consumer; update its changed mask
+    void UpdateChanged(ChangeState &changes, const double *angles);
+    // reset the change state of a consumer -> every joint counts as changed at its next update
+    void ResetChanged(ChangeState &changes);
+    // reset the change detection of all consumers and the population cache
+    void ResetChanged();
+    // read all joint angles into angles_buffer for the population readings (buffer_mutex held); with the population cache, joints within their deadband keep the held angle
+    void ReadEncodersChanged();
+    // encode the joint population for the angle in angles_buffer into the given output array; copied from the population cache if enabled
+    void EncodeBuffered(int joint, double *out);
+    // encode the neurons [first, last) of the joint population for the angle in angles_buffer; copied from the population cache if enabled
+    void EncodeBuffered(int joint, int first, int last, double *out);
     // encode joint position into a vector
     std::vector<double> Encode(double joint_angle, int joint);
-    // return the normal distribution value for a given value, mean and sigma
-    double NormalPdf(double value, double mean, double sigma);
+    // encode joint position into the given output array with the size of the joint population
+    void Encode(double joint_angle, int joint, double *out);
+    // encode joint position for the neurons [first, last) of the joint population into the given output array; dispatch to the coding
+    void EncodeRange(double joint_angle, int joint, int first, int last, double *out);
+    // encode joint position for the neurons [first, last) with the given coding -> specialized per coding, no dispatch in the neuron loop
+    template <PopCoding C>
+    void EncodeRangeImpl(double joint_angle, int joint, int first, int last, double *out);
+    // return the neuron index range [first, last) within the encoding window of the joint angle
+    void EncodeWindow(double joint_angle, int joint, int &first, int &last);
+    // return the Gaussian lookup table exp(-0.5 x^2) for x in [0, lut_cutoff], lut_res entries per unit
+    static const std::vector<double> &GaussianLUT();
+    // compute the von Mises lookup table for the current sigma
+    void InitVonMisesLUT();
 };
@@ -22,6 +22,7 @@
 #include <yarp/dev/all.h>
 #include <yarp/sig/all.h>
 
+#include <cstddef>
 #include <iostream>
 #include <memory>
 #include <sstream>
@@ -53,12 +54,13 @@ class JointWriter : public Mod_BaseClass {
      * \param[in] deg_per_neuron (default = 0.0) degree per neuron in the populations, encoding the joints angles; if set: population size depends on joint working range
      * \param[in] speed Velocity to set for the joint motions.
      * \param[in] ini_path Path to the "interface_param.ini"-file.
+     * \param[in] carrier (default = "") YARP carrier for the robot connections, e.g. tcp, fast_tcp, shmem, udp; empty: carrier option of the ini file
      * \return True, if the initializatiion was successful. False if an error occured. Additionally, an error message is written to the error stream (cerr).\n
      *          Typical errors:
      *              - arguments not valid: e.g. part string not correct or ini file not in given path
      *              - YARP-Server not running
      */
-    bool Init(std::string part, unsigned int pop_size, double deg_per_neuron, double speed, std::string ini_path);
+    bool Init(std::string part, unsigned int pop_size, double deg_per_neuron, double speed, std::string ini_path, std::string carrier = "");
 
     /**
      * \brief Initialize the joint writer with given parameters
@@ -72,13 +74,14 @@ class JointWriter : public Mod_BaseClass {
      * \param[in] ini_path Path to the "interface_param.ini"-file.
      * \param[in] ip_address gRPC server ip address -> has to match ip address of the JointControl-Population
      * \param[in] port gRPC server port -> has to match port of the JointControl-Population
+     * \param[in] carrier (default = "") YARP carrier for the robot connections, e.g. tcp, fast_tcp, shmem, udp; empty: carrier option of the ini file
      * \return True, if the initializatiion was successful. False if an error occured. Additionally, an error message is written to the error stream (cerr).\n
      *          Typical errors:
      *              - arguments not valid: e.g. part string not correct or ini file not in given path
      *              - YARP-Server not running
      */
     bool InitGRPC(std::string part, unsigned int pop_size, std::vector<int> joint_select, std::string mode, bool blocking,
-                  double deg_per_neuron, double speed, std::string ini_path, std::string ip_address, unsigned int port);
+                  double deg_per_neuron, double speed, std::string ini_path, std::string ip_address, unsigned int port, std::string carrier = "");
 
     /**
      * \brief  Close joint writer with cleanup
@@ -210,7 +213,7 @@ class JointWriter : public Mod_BaseClass {
      * \return True, if successful. False if an error occured. Additionally, an error message is written to the error stream (cerr).\n
      *          Typical errors:
      *              - arguments not valid: joints out of range; positioning mode not valid; position_pops size does not fit joint count
-     *              - position decoding returned NaN
+     *              - population code not finite (populations without activity keep the joint at its position)
      *              - missing initialization
      */
     bool WritePopAll(std::vector<std::vector<double>> position_pops, std::string mode, bool blocking, time_t timeout);
@@ -225,7 +228,7 @@ class JointWriter : public Mod_BaseClass {
      * \return True, if successful. False if an error occured. Additionally, an error message is written to the error stream (cerr).
      *          Typical errors:
      *              - arguments not valid: joints out of range; positioning mode not valid; position_pops size does not fit joint selection
-     *              - position decoding returned NaN
+     *              - population code not finite (populations without activity keep the joint at its position)
      *              - missing initialization
      */
     bool WritePopMultiple(std::vector<std::vector<double>> position_pops, std::vector<int> joint_selection, std::string mode,
@@ -241,16 +244,50 @@ class JointWriter : public Mod_BaseClass {
      * \return True, if successful. False if an error occured. Additionally, an error message is written to the error stream (cerr).\n
      *          Typical errors:
      *              - arguments not valid: joint out of range; positioning mode not valid
-     *              - position decoding returned NaN
+     *              - population code not finite (populations without activity keep the joint at its position)
      *              - missing initialization
      */
     bool WritePopOne(std::vector<double> position_pop, int joint, std::string mode, bool blocking, time_t timeout);
 
+    /**
+     * \brief Write all joints with joint angles encoded in populations, given as one contiguous array (joints x row_size), e.g. a NumPy array without copy.
+     * \param[in] position_pops contiguous populations, one row per joint; the first neurons of every row hold the joint population
+     * \param[in] size number of elements of the input
+     * \param[in] row_size number of values per joint row; at least the population size of every joint
+     * \param[in] mode string to select the motion mode: possible are 'abs' for absolute joint angle positions and 'rel' for relative joint angles
+     * \param[in] blocking if True, function waits for end of motion
+     * \param[in] timeout time in seconds, to wait for motion execution
+     * \return True, if successful. False if an error occured. Additionally, an error message is written to the error stream (cerr).\n
+     *          Typical errors:
+     *              - arguments not valid: positioning mode not valid; size does not fit joint count x row size; row size smaller than a population
+     *              - population code not finite (populations without activity keep the joint at its position)
+     *              - missing initialization
+     */
+    bool WritePopAllArray(const double *position_pops, size_t size, unsigned int row_size, std::string mode, bool blocking, time_t timeout);
+
+    /**
+     * \brief Write multiple joints with joint angles encoded in populations, given as one contiguous array (selected joints x row_size), e.g. a NumPy array without copy.
+     * \param[in] position_pops contiguous populations, one row per selected joint; the first neurons of every row hold the joint population
+     * \param[in] size number of elements of the input
+     * \param[in] row_size number of values per joint row; at least the population size of every selected joint
+     * \param[in] joint_selection Joint indizes of the joints, which should be moved (head: 3, 4, 5 -> all eye movements)
+     * \param[in] mode string to select the motion mode: possible are 'abs' for absolute joint angle positions and 'rel' for relative joint angles
+     * \param[in] blocking if True, function waits for end of motion
+     * \param[in] timeout time in seconds, to wait for motion execution
+     * \return True, if successful. False if an error occured. Additionally, an error message is written to the error stream (cerr).\n
+     *          Typical errors:
+     *              - arguments not valid: joints out of range; positioning mode not valid; size does not fit joint selection x row size
+     *              - population code not finite (populations without activity keep the joint at its position)
+     *              - missing initialization
+     */
+    bool WritePopMultipleArray(const double *position_pops, size_t size, unsigned int row_size, std::vector<int> joint_selection, std::string mode, bool blocking,
+                               time_t timeout);
+
     /**
      * \brief Write all joints with double values.
      * \param[in] position_pop Population encoded joint angle for writing to the robot joint
      * \param[in] joint Joint number of the robot part
-     * \return Decoded joint angle as double value
+     * \return Decoded joint angle as double value; the current joint angle for a population without activity; NaN if the population code is not valid
      */
     double Decode_ext(std::vector<double> position_pop, int joint);
 
@@ -291,6 +328,10 @@ class JointWriter : public Mod_BaseClass {
     std::vector<double> joint_max;                      // maximum possible joint angles
     std::vector<std::vector<double>> neuron_deg_abs;    // vector of vectors representing the degree values for the neuron populations
     std::vector<std::vector<double>> neuron_deg_rel;    // vector of vectors representing the degree values for the neuron populations
+    std::vector<double> decode_deg_abs;                 // degree values of the absolute populations, contiguous joints x decode_stride table
+    std::vector<double> decode_deg_rel;                 // degree values of the relative populations, contiguous joints x decode_stride table
+    size_t decode_stride = 0;                           // row length of the decoding tables -> largest population
+    std::vector<double> encoder_buffer;                 // joint angles for the clamping of relative motions
 
     /*** yarp data structures ***/
     yarp::sig::Vector joint_angles;       // yarp vector for reading all joint angles
@@ -310,15 +351,18 @@ class JointWriter : public Mod_BaseClass {
     bool _blocking;                                       // blocking status for gRPC-based motion execution
     std::string _mode;                                    // mode (e.g. absolut or relative) for gRPC-based motion execution
     double joint_value;                                   // single joint positon for gRPC-based motion execution
-    std::vector<double> joint_value_1dvector;    // multi joint positon or single joint encoded position for gRPC-based motion execution
-    std::vector<std::vector<double>> joint_value_2dvector;    // multi joint encoded position for gRPC-based motion execution
+    std::vector<double> joint_value_1dvector;    // multi joint positon or (multi) joint encoded position for gRPC-based motion execution
 #endif
 
     /*** auxilary methods ***/
     // check if iCub part key is valid
     bool CheckPartKey(std::string key);
-    // decode the population coded joint angle to double value
-    double Decode(std::vector<double> position_pop, int joint, std::vector<std::vector<double>> neuron_deg);
+    // decode the population coded joint angle to double value; the size has to match the joint population; populations without activity keep the joint at its position
+    bool Decode(const double *position_pop, size_t size, int joint, bool relative, double &angle);
+    // write the joints with concatenated populations of the joint population sizes; joint_selection nullptr -> all joints
+    bool WritePopConcat(const double *position_pops, size_t size, int count, int *joint_selection, std::string mode, bool blocking, time_t timeout);
+    // move the joints to the decoded joint angles in joint_angles; joint_selection nullptr -> all joints
+    bool MoveDecoded(int count, int *joint_selection, bool relative, bool blocking, time_t timeout);
     // Auxilaries
     template <typename T>
     std::string vec2string(const T &vec);
@@ -52,12 +52,13 @@ class KinematicReader : public Mod_BaseClass {
      * \param[in] version iCub hardware version
      * \param[in] ini_path Path to the "interface_param.ini"-file.
      * \param[in] offline_mode flag if limits are retrieved from running iCub -> if true no running iCub is necessary
+     * \param[in] carrier (default = "") YARP carrier for the robot connections, e.g. tcp, fast_tcp, shmem, udp; empty: carrier option of the ini file
      * \return True, if the initializatiion was successful. False if an error occured. Additionally, an error message is written to the error stream (cerr).\n
      *          Typical errors:
      *              - arguments not valid: e.g. part string not correct or ini file not in given path \n
      *              - YARP-Server not running
      */
-    bool Init(std::string part, float version, std::string ini_path, bool offline_mode);
+    bool Init(std::string part, float version, std::string ini_path, bool offline_mode, std::string carrier = "");
 
     /**
      * \brief Initialize the kinematic reader with given parameters
@@ -66,12 +67,13 @@ class KinematicReader : public Mod_BaseClass {
      * \param[in] ini_path Path to the "interface_param.ini"-file.
      * \param[in] ip_address gRPC server ip address -> has to match ip address of the JointReadOut-Population
      * \param[in] port gRPC server port -> has to match port of the JointReadOut-Population
+     * \param[in] carrier (default = "") YARP carrier for the robot connections, e.g. tcp, fast_tcp, shmem, udp; empty: carrier option of the ini file
      * \return True, if the initializatiion was successful. False if an error occured. Additionally, an error message is written to the error stream (cerr).\n
      *          Typical errors:
      *              - arguments not valid: e.g. part string not correct or ini file not in given path \n
      *              - YARP-Server not running
      */
-    bool InitGRPC(std::string part, float version, std::string ini_path, std::string ip_address, unsigned int port, bool offline_mode);
+    bool InitGRPC(std::string part, float version, std::string ini_path, std::string ip_address, unsigned int port, bool offline_mode, std::string carrier = "");
 
     /**
      * \brief  Close kinematic reader with cleanup
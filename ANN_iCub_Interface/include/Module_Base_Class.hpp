@@ -19,6 +19,7 @@
 
 #pragma once
 
+#include <cstdint>
 #include <iostream>
 #include <map>
 #include <string>
@@ -30,6 +31,7 @@
 class Mod_BaseClass {
  private:
     bool registered = false;
+    bool standalone = false;    // module owned by another module, not registered at the main Interface
 
  protected:
     // check if init function was called
@@ -52,6 +54,10 @@ class Mod_BaseClass {
     void setRegister(bool value);
     bool getRegister();
 
+    // Get/Set value for standalone usage -> module is owned by another module and needs no registration
+    void setStandalone(bool value);
+    bool getStandalone();
+
     // get methods for class specific variables
     std::string get_identifier();
     std::map<std::string, std::string> getParameter();
@@ -63,5 +69,10 @@ class Mod_BaseClass {
     virtual std::vector<double> provideData(int value, bool enc);
     virtual std::vector<double> provideData(std::vector<int> value, bool enc);
     virtual std::vector<double> provideData(bool enc);
+    virtual std::vector<double> provideSparseData(std::vector<int>& start, std::vector<int>& count);
+    virtual std::vector<double> provideChangedData(uint64_t consumer, bool enc, bool sparse, bool resync, std::vector<int>& joint, std::vector<int>& start,
+                                                   std::vector<int>& count);
     virtual std::vector<double> provideData(int value);
+    virtual std::vector<uint8_t> provideRawData();
+    virtual std::vector<int> provideImageGeometry();
 };
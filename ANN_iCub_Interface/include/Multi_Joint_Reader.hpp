@@ -0,0 +1,124 @@
+/*
+ *  Copyright (C) 2019-2024 Torsten Fietzek
+ *
+ *  Multi_Joint_Reader.hpp is part of the ANNarchy iCub interface
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  The ANNarchy iCub interface is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this headers. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "Joint_Reader.hpp"
+#include "Module_Base_Class.hpp"
+#include "Thread_Pool.hpp"
+
+/**
+ * \brief  Read-out of the joint angles of several iCub robot parts at once. Every part has its own control board driver; the parts are read
+ *         concurrently and the joint angles are written into one contiguous vector (population tensor) in the order of the part list.
+ */
+class MultiJointReader : public Mod_BaseClass {
+ public:
+    // Constructor
+    MultiJointReader() = default;
+    // Destructor
+    ~MultiJointReader();
+
+    /*** public methods for the user ***/
+
+    /**
+     * \brief Initialize the multi-part joint reader with given parameters
+     * \param[in] parts Robot parts in the output order, have to match iCub part naming {left_(arm/leg), right_(arm/leg), head, torso}; every part only once.
+     * \param[in] sigma Standard deviation for the joints angles populations coding.
+     * \param[in] pop_n Number of neurons per population, encoding each one joint angle; only works if parameter "deg_per_neuron" is not set
+     * \param[in] deg_per_neuron (default = 0.0) degree per neuron in the populations, encoding the joints angles; if set: population size depends on joint working range
+     * \param[in] ini_path Path to the "interface_param.ini"-file.
+     * \param[in] carrier (default = "") YARP carrier for the robot connections, e.g. tcp, fast_tcp, shmem, udp; empty: carrier option of the ini file
+     * \param[in] coding (default = "gaussian") population coding of the joint angles: gaussian, von_mises (wrap-around joints) or thermometer
+     * \return True, if the initializatiion was successful. False if an error occured. Additionally, an error message is written to the error stream (cerr).\n
+     *          Typical errors:
+     *              - arguments not valid: e.g. part string not correct, part given twice or ini file not in given path \n
+     *              - YARP-Server not running
+     */
+    bool Init(std::vector<std::string> parts, double sigma, unsigned int pop_n, double deg_per_neuron, std::string ini_path, std::string carrier = "", std::string coding = "gaussian");
+
+    /**
+     * \brief  Close multi-part joint reader with cleanup
+     */
+    void Close() override;
+
+    /**
+     * \brief Select the sampling mode of all parts (see JointReader::SetSamplingMode).
+     * \param[in] threaded True for the background sampling; False to request the joint angles from the robot with every reading
+     * \param[in] rate (default = 1000.) sampling rate in Hz of the background sampling
+     * \return True, if successful.
+     */
+    bool SetSamplingMode(bool threaded, double rate = 1000.);
+
+    /**
+     * \brief Return the robot parts in the output order.
+     */
+    std::vector<std::string> GetParts();
+
+    /**
+     * \brief Return the number of joints of all parts.
+     */
+    int GetJointCount();
+
+    /**
+     * \brief Return the offset table of the parts: the joints of part i are the entries offsets[i] ... offsets[i + 1] - 1 of the output; parts + 1 values.
+     */
+    std::vector<int> GetJointOffsets();
+
+    /**
+     * \brief Return the size of the largest joint population of all parts -> row size of the population tensor.
+     */
+    unsigned int GetMaxNeuronsPerJoint();
+
+    /**
+     * \brief Read all joints of all parts and return joint angles directly in degree as double values
+     * \return Joint angles of all parts in the order of the offset table, read from the robot in degree.
+     */
+    std::vector<double> ReadDoubleAll();
+
+    /**
+     * \brief Read all joints of all parts and write the joint angles in degree into a preallocated buffer, without memory allocation.
+     * \param[out] buffer output buffer for GetJointCount() values in the order of the offset table
+     * \param[in] size number of elements of the buffer
+     * \return True, if successful. False if the reader is not initialized or the buffer size does not match.
+     */
+    bool ReadDoubleAllInto(double *buffer, size_t size);
+
+    /**
+     * \brief Read all joints of all parts and write the joint angles encoded in populations into a preallocated buffer, without memory allocation.
+     * \param[out] buffer output buffer for GetJointCount() x GetMaxNeuronsPerJoint() values; the rows of joints with smaller populations are zero padded
+     * \param[in] size number of elements of the buffer
+     * \return True, if successful. False if the reader is not initialized or the buffer size does not match.
+     */
+    bool ReadPopAllInto(double *buffer, size_t size);
+
+ private:
+    std::vector<std::string> parts;                      // robot parts in the output order
+    std::vector<std::unique_ptr<JointReader>> readers;   // joint reader per part, each with its own control board driver
+    std::vector<int> offsets;                            // index of the first joint of every part in the output; parts + 1 values
+    unsigned int max_neurons = 0;                        // size of the largest population of all parts
+    std::unique_ptr<ThreadPool> pool;                    // workers reading the parts concurrently; the calling thread reads the last part
+
+    // run the reading of every part concurrently; read(i) reads part i and returns true on success
+    template <typename F>
+    bool ReadParts(F &&read);
+};
@@ -0,0 +1,115 @@
+/*
+ *  Copyright (C) 2019-2024 Torsten Fietzek
+ *
+ *  Seq_Lock.hpp is part of the ANNarchy iCub interface
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  The ANNarchy iCub interface is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this headers. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include <thread>
+
+/**
+ * \brief Sequence lock for a fixed size sample of double values with a timestamp; one writer thread, any number of readers.
+ *        The writer never waits, the readers copy the newest complete sample and retry only if it was overwritten during the copy.
+ */
+class SeqLock {
+ public:
+    SeqLock() = default;
+
+    SeqLock(const SeqLock &) = delete;
+    SeqLock &operator=(const SeqLock &) = delete;
+
+    /**
+     * \brief Allocate the sample; not thread safe -> call once, before any writer or reader uses the lock.
+     * \param[in] size number of values per sample
+     */
+    void Resize(size_t size) {
+        values.reset(new std::atomic<double>[size]);
+        for (size_t i = 0; i < size; i++) {
+            values[i].store(0., std::memory_order_relaxed);
+        }
+        n_values = size;
+        sequence.store(0, std::memory_order_release);
+    }
+
+    /**
+     * \brief Return the number of values per sample.
+     */
+    size_t Size() const { return n_values; }
+
+    /**
+     * \brief Publish a new sample (writer thread only).
+     * \param[in] data Size() values of the sample
+     * \param[in] time timestamp of the sample
+     */
+    void Write(const double *data, double time) {
+        auto seq = sequence.load(std::memory_order_relaxed);
+        // odd sequence -> write in progress
+        sequence.store(seq + 1, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_release);
+        for (size_t i = 0; i < n_values; i++) {
+            values[i].store(data[i], std::memory_order_relaxed);
+        }
+        timestamp.store(time, std::memory_order_relaxed);
+        sequence.store(seq + 2, std::memory_order_release);
+    }
+
+    /**
+     * \brief Copy the newest complete sample.
+     * \param[out] data output array for Size() values
+     * \param[out] time timestamp of the sample
+     * \return number of the sample (number of written samples); 0 -> no sample written yet
+     */
+    unsigned long long Read(double *data, double &time) const { return Read(data, time, 0, n_values); }
+
+    /**
+     * \brief Copy a range of the newest complete sample.
+     * \param[out] data output array for count values
+     * \param[out] time timestamp of the sample
+     * \param[in] first index of the first copied value
+     * \param[in] count number of copied values; first + count <= Size()
+     * \return number of the sample (number of written samples); 0 -> no sample written yet
+     */
+    unsigned long long Read(double *data, double &time, size_t first, size_t count) const {
+        unsigned long long seq0, seq1;
+        do {
+            seq0 = sequence.load(std::memory_order_acquire);
+            if (seq0 & 1) {
+                std::this_thread::yield();
+                continue;
+            }
+            for (size_t i = 0; i < count; i++) {
+                data[i] = values[first + i].load(std::memory_order_relaxed);
+            }
+            time = timestamp.load(std::memory_order_relaxed);
+            std::atomic_thread_fence(std::memory_order_acquire);
+            seq1 = sequence.load(std::memory_order_relaxed);
+            if (seq0 == seq1) {
+                break;
+            }
+        } while (true);
+        return seq0 / 2;
+    }
+
+ private:
+    std::atomic<unsigned long long> sequence{0};      // sequence counter; odd while a sample is written
+    std::unique_ptr<std::atomic<double>[]> values;    // values of the newest sample
+    std::atomic<double> timestamp{0.};                // timestamp of the newest sample
+    size_t n_values = 0;                              // number of values per sample
+};
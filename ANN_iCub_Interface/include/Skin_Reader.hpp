@@ -57,12 +57,13 @@ class SkinReader : public Mod_BaseClass {
      * \param[in] arm character to choose the arm side (r/R for right; l/L for left)
      * \param[in] norm_data if True, data is normalized from 0..255 to 0..1.0
      * \param[in] ini_path Path to the "interface_param.ini"-file.
+     * \param[in] carrier (default = "") YARP carrier for the robot connections, e.g. tcp, fast_tcp, shmem, udp; empty: carrier option of the ini file
      * \return True, if the initializatiion was successful. False if an error occured. Additionally, an error message is written to the error stream (cerr).\n
      *          Typical errors:
      *              - arguments not valid: e.g. arm character not correct; ini file not in given path
      *              - YARP-Server not running
      */
-    bool Init(std::string name, char arm, bool norm_data, std::string ini_path);
+    bool Init(std::string name, char arm, bool norm_data, std::string ini_path, std::string carrier = "");
 
     /**
      * \brief Initialize skin reader with given parameters.
@@ -71,12 +72,13 @@ class SkinReader : public Mod_BaseClass {
      * \param[in] ini_path Path to the "interface_param.ini"-file.
      * \param[in] ip_address gRPC server ip address -> has to match ip address of the Vision-Population
      * \param[in] port gRPC server port -> has to match port of the Vision-Population
+     * \param[in] carrier (default = "") YARP carrier for the robot connections, e.g. tcp, fast_tcp, shmem, udp; empty: carrier option of the ini file
      * \return True, if the initializatiion was successful. False if an error occured. Additionally, an error message is written to the error stream (cerr).\n
      *          Typical errors:
      *              - arguments not valid: e.g. arm character not correct; ini file not in given path
      *              - YARP-Server not running
      */
-    bool InitGRPC(std::string name, char arm, bool norm_data, std::string ini_path, std::string ip_address, unsigned int port);
+    bool InitGRPC(std::string name, char arm, bool norm_data, std::string ini_path, std::string ip_address, unsigned int port, std::string carrier = "");
 
     /**
      * \brief  Close and clean skin reader
@@ -0,0 +1,132 @@
+/*
+ *  Copyright (C) 2019-2024 Torsten Fietzek
+ *
+ *  Thread_Pool.hpp is part of the ANNarchy iCub interface
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  The ANNarchy iCub interface is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this headers. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include <condition_variable>
+#include <cstdint>
+#include <functional>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <queue>
+#include <thread>
+#include <utility>
+#include <vector>
+
+/**
+ * \brief Small pool of persistent worker threads, to run tasks in parallel without starting a new thread per task.
+ */
+class ThreadPool {
+ public:
+    /**
+     * \brief Start the worker threads.
+     * \param[in] n_threads number of worker threads
+     */
+    explicit ThreadPool(unsigned int n_threads);
+
+    /**
+     * \brief Finish the queued tasks and stop the worker threads.
+     */
+    ~ThreadPool();
+
+    ThreadPool(const ThreadPool &) = delete;
+    ThreadPool &operator=(const ThreadPool &) = delete;
+
+    /**
+     * \brief Queue a task for the execution by one of the worker threads.
+     * \param[in] task callable without arguments
+     * \return future holding the return value of the task (or the thrown exception)
+     */
+    template <typename F>
+    auto Submit(F &&task) -> std::future<decltype(task())> {
+        using R = decltype(task());
+        auto job = std::make_shared<std::packaged_task<R()>>(std::forward<F>(task));
+        auto result = job->get_future();
+        {
+            std::lock_guard<std::mutex> lock(queue_mutex);
+            tasks.emplace([job]() { (*job)(); });
+        }
+        queue_cond.notify_one();
+        return result;
+    }
+
+    /**
+     * \brief Return the number of worker threads.
+     */
+    unsigned int Size() const { return static_cast<unsigned int>(workers.size()); }
+
+ private:
+    std::vector<std::thread> workers;            // worker threads
+    std::queue<std::function<void()>> tasks;     // queued tasks
+    std::mutex queue_mutex;                      // protects the task queue and the stop flag
+    std::condition_variable queue_cond;          // signals new tasks and the shutdown
+    bool stop = false;                           // flag to stop the worker threads
+
+    // take tasks from the queue and execute them until the pool is stopped
+    void WorkerLoop();
+};
+
+/**
+ * \brief Persistent worker thread running one read call at a time (e.g. the right eye of a binocular read). The call is placed in a
+ *        preallocated slot and handed over with a condition variable -> starting a call and waiting for its result allocate nothing.
+ */
+class ReadWorker {
+ public:
+    /**
+     * \brief Start the worker thread.
+     */
+    ReadWorker();
+
+    /**
+     * \brief Finish a running call and stop the worker thread.
+     */
+    ~ReadWorker();
+
+    ReadWorker(const ReadWorker &) = delete;
+    ReadWorker &operator=(const ReadWorker &) = delete;
+
+    /**
+     * \brief Start the read call on the worker thread; the function has to stay valid until Wait returns. Only one call at a time.
+     * \param[in] read read function (eye index, output pointer)
+     * \param[in] eye_idx eye index passed to the read function
+     * \param[in] out output pointer passed to the read function
+     */
+    void Start(const std::function<bool(int, uint8_t *)> &read, int eye_idx, uint8_t *out);
+
+    /**
+     * \brief Wait for the started read call.
+     * \return result of the read function; false, if it threw an exception
+     */
+    bool Wait();
+
+ private:
+    std::thread worker;                                          // worker thread
+    std::mutex slot_mutex;                                       // protects the task slot and the flags
+    std::condition_variable slot_cond;                           // signals a started call, its completion and the shutdown
+    const std::function<bool(int, uint8_t *)> *read = nullptr;   // task slot: read function
+    int eye_idx = 0;                                             // task slot: eye index
+    uint8_t *out = nullptr;                                      // task slot: output pointer
+    bool result = false;                                         // result of the last call
+    bool pending = false;                                        // flag, being true from Start until the call finished
+    bool stop = false;                                           // flag to stop the worker thread
+
+    // run the started calls until the worker is stopped
+    void WorkerLoop();
+};
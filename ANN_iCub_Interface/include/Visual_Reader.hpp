@@ -22,14 +22,22 @@
 #include <yarp/os/all.h>
 #include <yarp/sig/all.h>
 
+#include <atomic>
 #include <deque>
+#include <functional>
 #include <map>
+#include <memory>
+#include <mutex>
 #include <opencv2/opencv.hpp>
 #include <string>
 #include <thread>
 #include <vector>
 
+#include "Camera_Source.hpp"
+#include "Filter_Bank.hpp"
+#include "Image_Processor.hpp"
 #include "Module_Base_Class.hpp"
+#include "Thread_Pool.hpp"
 #ifdef _USE_GRPC
 #include "ProvideInputServer.h"
 #endif
@@ -39,16 +47,6 @@
  */
 class VisualReader : public Mod_BaseClass {
  public:
-#ifndef _DOUBLE_PRECISION
-    typedef float precision;
-    bool double_prec = false;
-#endif
-#ifdef _DOUBLE_PRECISION
-    typedef double precision;
-    bool double_prec = true;
-
-#endif
-
     VisualReader() = default;
     ~VisualReader();
 
@@ -62,12 +60,16 @@ class VisualReader : public Mod_BaseClass {
      * \param[in] img_width output image width in pixel (input width: 320px)
      * \param[in] img_height output image height in pixel (input height: 240px)
      * \param[in] fast_filter flag to select the filter for image upscaling; True for a faster filter
+     * \param[in] ini_path path to the "interface_param.ini"-file; the [vision] section selects gray/color output, the output element type
+     *                     (dtype: uint8, float16, float32, float64) and the log-polar retina layout (log_polar, log_polar_rings, log_polar_wedges,
+     *                     log_polar_fovea), which replaces img_width/img_height by wedges/rings
+     * \param[in] carrier (default = "") YARP carrier for the robot connections, e.g. tcp, fast_tcp, shmem, udp; empty: carrier option of the ini file
      * \return True, if the initializatiion was successful. False if an error occured. Additionally, an error message is written to the error stream (cerr).\n
      *          Typical errors:
      *              - arguments not valid: e.g. eye character not valid
      *              - YARP-Server not running
      */
-    bool Init(char eye, double fov_width, double fov_height, int img_width, int img_height, bool fast_filter, std::string ini_path);
+    bool Init(char eye, double fov_width, double fov_height, int img_width, int img_height, bool fast_filter, std::string ini_path, std::string carrier = "");
 
     /**
      * \brief Init Visual reader with given parameters for image resolution, field of view and eye selection.
@@ -77,20 +79,106 @@ class VisualReader : public Mod_BaseClass {
      * \param[in] img_width output image width in pixel (input width: 320px)
      * \param[in] img_height output image height in pixel (input height: 240px)
      * \param[in] fast_filter flag to select the filter for image upscaling; True for a faster filter
+     * \param[in] ini_path path to the "interface_param.ini"-file; the [vision] section selects gray/color output, the output element type and the log-polar retina layout
      * \param[in] ip_address gRPC server ip address -> has to match ip address of the Vision-Population
      * \param[in] port gRPC server port -> has to match port of the Vision-Population
+     * \param[in] carrier (default = "") YARP carrier for the robot connections, e.g. tcp, fast_tcp, shmem, udp; empty: carrier option of the ini file
      * \return True, if the initializatiion was successful. False if an error occured. Additionally, an error message is written to the error stream (cerr).\n
      *          Typical errors:
      *              - arguments not valid: e.g. eye character not valid
      *              - YARP-Server not running
      */
-    bool InitGRPC(char eye, double fov_width, double fov_height, int img_width, int img_height, bool fast_filter, std::string ini_path, std::string ip_address, unsigned int port);
+    bool InitGRPC(char eye, double fov_width, double fov_height, int img_width, int img_height, bool fast_filter, std::string ini_path, std::string ip_address, unsigned int port, std::string carrier = "");
 
     /**
      * \brief Read a set of images from the robot cameras -> dependent on init selection.
-     * \return camera images -> grayscale, [0., 1.]
+     * \return camera images; values of the selected output type -> uint8: [0, 255]; float16/32/64: [0., 1.]
+     */
+    std::vector<std::vector<double>> ReadRobotEyes();
+
+    /**
+     * \brief Read a set of images from the robot cameras and write them directly into a caller owned buffer -> dependent on init selection.
+     * \param[out] buffer preallocated buffer with elements of the output type (GetOutputType); images are stored consecutively as flattened images
+     *                    (same order as in ReadRobotEyes)
+     * \param[in] size number of elements in the buffer, has to match the product of GetOutputShape()
+     * \return True, if the images were written to the buffer. False if an error occured, e.g. buffer size does not match or no image was received.
+     */
+    bool ReadRobotEyesBuffer(void *buffer, size_t size);
+
+    /**
+     * \brief Return the element type of the processed camera images, selected with the "dtype" option in the [vision] section of the ini file.
+     * \return 0: uint8 [0, 255]; 1: float16; 2: float32; 3: float64 [0., 1.]
      */
-    std::vector<std::vector<precision>> ReadRobotEyes();
+    int GetOutputType();
+
+    /**
+     * \brief Return the shape of the processed camera images.
+     * \return vector with the number of images (1 or 2 in binocular mode) and the number of elements per flattened image
+     */
+    std::vector<int> GetOutputShape();
+
+    /**
+     * \brief Return the shape of a single processed camera image.
+     * \return vector with image height, width and channel count; for the log-polar layout the height is the number of rings and the width the number of wedges
+     */
+    std::vector<int> GetImageShape();
+
+    /**
+     * \brief Return the sampling layout of the processed camera images, selected with the "log_polar" option in the [vision] section of the ini file.
+     * \return 0 for the cartesian layout; 1 for the log-polar retina layout
+     */
+    int GetImageLayout();
+
+    /**
+     * \brief Set the number of levels of the image pyramid returned by ReadRobotEyesPyramid.
+     * \param[in] levels number of levels; level 0 is the processed image, each further level halves the image size (area downscaling)
+     * \return True, if the number of levels was set successfully.
+     */
+    bool SetPyramidLevels(int levels);
+
+    /**
+     * \brief Return the offset table of the pyramid buffer.
+     * \return start offsets of all levels for each image (right eye first in binocular mode) and the total buffer size as last entry
+     */
+    std::vector<size_t> GetPyramidOffsets();
+
+    /**
+     * \brief Return the image size of the pyramid levels.
+     * \return height and width of each level, stored consecutively
+     */
+    std::vector<int> GetPyramidShapes();
+
+    /**
+     * \brief Read a set of images from the robot cameras and write the image pyramids into a caller owned buffer. All levels are computed from one capture,
+     *        each level from the previous one.
+     * \param[out] buffer preallocated buffer with elements of the output type (GetOutputType); layout given by GetPyramidOffsets
+     * \param[in] size number of elements in the buffer, has to match the last entry of GetPyramidOffsets
+     * \return True, if the pyramids were written to the buffer.
+     */
+    bool ReadRobotEyesPyramid(void *buffer, size_t size);
+
+    /**
+     * \brief Move the region of view (cropped field of view) without reinitialization; the output image size is kept.
+     *        The resampling tables are computed for a pending processor and swapped in by the next read of each eye, so the call may overlap
+     *        with reads (e.g. gRPC requests).
+     *        Runtime setting: a robot saved to XML is restored with the region of view of the initialization.
+     * \param[in] center_x horizontal center of the region of view in degree (0: optical axis; positive: right)
+     * \param[in] center_y vertical center of the region of view in degree (0: optical axis; positive: up)
+     * \param[in] fov_width field of view width in degree; the region has to stay inside the camera field of view (60°)
+     * \param[in] fov_height field of view height in degree; the region has to stay inside the camera field of view (48°)
+     * \return True, if the region of view was set successfully. Otherwise the previous region of view is kept for both eyes.
+     */
+    bool SetRegionOfView(double center_x, double center_y, double fov_width, double fov_height);
+
+    /**
+     * \brief Compute the region of view in the camera image for a field of view; same conversion as used by Init and SetRegionOfView.
+     * \param[in] center_x horizontal center of the field of view in degree (positive: right)
+     * \param[in] center_y vertical center of the field of view in degree (positive: up)
+     * \param[in] fov_width field of view width in degree
+     * \param[in] fov_height field of view height in degree
+     * \return region of view in pixel; not checked against the camera image
+     */
+    static cv::Rect FovToRegionOfView(double center_x, double center_y, double fov_width, double fov_height);
 
     /**
      * \brief Read an image from the robot camera -> dependent on init selection.
@@ -98,13 +186,103 @@ class VisualReader : public Mod_BaseClass {
      */
     std::vector<uint8_t> RetrieveRobotEye();
 
+    /**
+     * \brief Select the capture mode. The camera images are always received in the background by the shared camera source.
+     *        In threaded mode read calls return immediately with the newest frame; otherwise they wait for the next camera image.
+     * \param[in] threaded True to return the newest frame; False to wait for the next frame
+     * \return True, if the capture mode was set successfully.
+     */
+    bool SetCaptureMode(bool threaded);
+
+    /**
+     * \brief Return the sequence numbers of the images returned by the last read call (same order as the images).
+     *        A repeated sequence number marks a frame, which was already returned before.
+     * \return frame sequence numbers
+     */
+    std::vector<unsigned long long> GetFrameSequence();
+
+    /**
+     * \brief Return the timestamps of the images returned by the last read call (same order as the images).
+     * \return frame timestamps in seconds; taken from the YARP envelope if available, otherwise the receive time
+     */
+    std::vector<double> GetFrameTimestamp();
+
+    /**
+     * \brief Set the contrast threshold for the event output and reset the event reference frame.
+     * \param[in] threshold minimal change of the log-intensity, which triggers an event (> 0)
+     * \return True, if the threshold was set successfully.
+     */
+    bool SetEventThreshold(double threshold);
+
+    /**
+     * \brief Read a set of images and return only the pixels, whose log-intensity changed by more than the event threshold since their last event
+     *        (event-camera emulation). The first call after Init/SetEventThreshold only sets the reference frame and returns no events.
+     * \param[out] index flattened pixel indices of the events; the index refers to the buffer layout of ReadRobotEyesBuffer (binocular: right, left)
+     * \param[out] polarity event polarities -> 1: brighter; -1: darker
+     * \param[out] timestamp frame timestamps of the events in seconds
+     * \return True, if the images were read successfully.
+     */
+    bool ReadRobotEyesEvents(std::vector<int> &index, std::vector<int8_t> &polarity, std::vector<double> &timestamp);
+
+    /**
+     * \brief Select the stereo matcher for the disparity output (binocular mode, cartesian layout). The camera images are assumed to be rectified.
+     * \param[in] method matching algorithm -> 0: block matching (StereoBM); 1: semi-global block matching (StereoSGBM)
+     * \param[in] num_disparities disparity search range in output pixels (positive multiple of 16, smaller than the output width)
+     * \param[in] block_size size of the matched blocks in output pixels (odd; block matching: [5, 255])
+     * \return True, if the stereo matcher was set successfully.
+     */
+    bool SetDisparity(int method, int num_disparities, int block_size);
+
+    /**
+     * \brief Read a set of images like ReadRobotEyesBuffer and compute the disparity map of the image pair at the output resolution (reference: left eye).
+     * \param[out] buffer caller owned buffer for the flattened images (right, left); elements of the output type
+     * \param[in] size number of elements in the image buffer
+     * \param[out] disparity caller owned buffer for the disparity map (output height x output width) in output pixels; -1 for pixels without a valid match
+     * \param[in] disparity_size number of elements in the disparity buffer
+     * \return True, if the images were read and the disparity was computed successfully.
+     */
+    bool ReadRobotEyesDisparity(void *buffer, size_t size, float *disparity, size_t disparity_size);
+
+    /**
+     * \brief Select a bank of oriented Gabor filters as output stage (cartesian layout); color images are converted to gray before the filtering.
+     * \param[in] orientations number of orientations, equally spaced in [0°, 180°)
+     * \param[in] wavelengths wavelengths of the sinusoidal carrier in output pixels (>= 2; one scale per wavelength)
+     * \param[in] phases phase offsets of the carrier in degree (0: even/symmetric; 90: odd/antisymmetric)
+     * \return True, if the filter bank was set successfully.
+     */
+    bool SetGaborFilters(int orientations, std::vector<double> wavelengths, std::vector<double> phases);
+
+    /**
+     * \brief Select a bank of ON/OFF difference-of-Gaussians as output stage (cartesian layout); each scale yields an ON and an OFF map.
+     * \param[in] sigmas standard deviations of the center Gaussians in output pixels (one scale per sigma)
+     * \param[in] surround_ratio ratio of the surround and the center standard deviation (> 1)
+     * \return True, if the filter bank was set successfully.
+     */
+    bool SetDoGFilters(std::vector<double> sigmas, double surround_ratio);
+
+    /**
+     * \brief Return the shape of the filter responses of a single image.
+     * \return number of filter maps, image height and image width; zeros if no filter bank is set
+     */
+    std::vector<int> GetFilterShape();
+
+    /**
+     * \brief Read a set of images and write the filter bank responses into the given buffer; per image one contiguous (filters x height x width) block.
+     *        Gabor responses are in [-1, 1], DoG responses in [0, 1]; uint8 output stores Gabor responses as 127.5 * (1 + r) and DoG responses scaled by 255.
+     * \param[out] buffer caller owned buffer for the filter responses; elements of the output type
+     * \param[in] size number of elements in the buffer (number of images x filters x height x width)
+     * \return True, if the filter responses were written to the buffer.
+     */
+    bool ReadRobotEyesFiltered(void *buffer, size_t size);
+
     /**
      * \brief Close Visual Reader module.
      */
     void Close() override;
 
 #ifdef _USE_GRPC
-    std::vector<double> provideData();
+    std::vector<uint8_t> provideRawData();
+    std::vector<int> provideImageGeometry();
 #endif
 
  private:
@@ -112,7 +290,7 @@ class VisualReader : public Mod_BaseClass {
     char act_eye;           // selected iCub eye to read images from
     int filter_ds;          // filter for the upscaling of the image
     bool cut_img;           // flag, being true if a part of the field of view is cutted of the image
-    precision norm_fact;    // normalization factor for the normalization of the image
+    double norm_fact;       // normalization factor for the normalization of the image
 
     /** fix iCub-visual data **/
     const int icub_width = 320;      // iCub image width in pixel
@@ -126,8 +304,13 @@ class VisualReader : public Mod_BaseClass {
     int rov_width;                      // image width for given horizontal field of view (ROV, region of view)
     int rov_height;                     // image height for given vertical field of view (ROV, region of view)
 
-    int out_width;     // output image width in pixel
-    int out_height;    // output image height in pixel
+    int out_width;       // output image width in pixel
+    int out_height;      // output image height in pixel
+    int out_channels;    // output image channel count (gray: 1; color: 3)
+    size_t out_size;     // number of elements of one flattened output image
+
+    ImageDType out_dtype = ImageDType::FLOAT64;    // element type of the output images
+    size_t out_elem_size = sizeof(double);         // size of one output element in bytes
 
     double res_scale_x;    // scaling factor in x direction to scale ROV to ouput image width
     double res_scale_y;    // scaling factor in y direction to scale ROV to ouput image height
@@ -135,21 +318,51 @@ class VisualReader : public Mod_BaseClass {
     int colorcode;
 
     /** image data structures **/
-    yarp::sig::ImageOf<yarp::sig::PixelRgb> *iEyeRgb;                  // YARP-image structure for image handling -> single eye
-    yarp::sig::ImageOf<yarp::sig::PixelRgb> *iEyeRgb_r, *iEyeRgb_l;    // YARP-image structure for image handling -> both eyes
+    std::shared_ptr<const CameraFrame> last_frame[2];    // last returned frames, held until the next read -> index 0: right eye; 1: left eye
+
+    ImageProcessor processor[2];    // single pass image preprocessing with precomputed resampling tables -> index 0: right eye; 1: left eye
 
-    cv::Mat RgbMat;
-    cv::Mat tmpMat, monoMat, ROV, tmpMat1;                                                   // matrices for image computations -> single eye
-    cv::Mat tmpMat_r, tmpMat_l, monoMat_r, monoMat_l, ROV_r, ROV_l, tmpMat1_r, tmpMat1_l;    // matrices for image computations -> both eye
-    int new_type;                                                                            // store CV data type for images -> single/double precision
+    /** region of view update **/
+    std::mutex rov_mutex;                      // guards the pending processors
+    ImageProcessor pending_processor[2];       // processors with the tables of the next region of view; swapped in by the next read of the eye
+    std::atomic<bool> rov_pending[2] = {};     // flag per eye, being true if the pending processor holds a new region of view
 
     /** yarp ports **/
-    std::string client_port_prefix;                                                // client portame prefix
-    std::string robot_port_prefix;                                                 // robot portname prefix
-    std::string robot_port_name_l;                                                 // robot portname left eye
-    std::string robot_port_name_r;                                                 // robot portname right eye
-    yarp::os::BufferedPort<yarp::sig::ImageOf<yarp::sig::PixelRgb>> port_right;    // port for the iCub right eye image
-    yarp::os::BufferedPort<yarp::sig::ImageOf<yarp::sig::PixelRgb>> port_left;     // port for the iCub left eye image
+    std::string client_port_prefix;                // client portame prefix
+    std::string robot_port_prefix;                 // robot portname prefix
+    std::string robot_port_name_l;                 // robot portname left eye
+    std::string robot_port_name_r;                 // robot portname right eye
+    std::shared_ptr<CameraSource> camera[2];       // shared camera sources -> index 0: right eye; 1: left eye
+
+    /** capture mode **/
+    bool capture_threaded = false;    // flag, being true if the newest frame is returned instead of waiting for the next frame
+
+    /** binocular processing **/
+    std::unique_ptr<ReadWorker> eye_worker;     // worker thread reading and processing the right eye in parallel to the left eye (binocular mode)
+
+    /** image pyramid **/
+    std::vector<int> pyramid_shapes;                // height and width of each pyramid level
+    std::vector<size_t> pyramid_level_offsets;      // start offsets of the levels in the pyramid of one image
+    size_t pyramid_size = 0;                        // number of elements of the pyramid of one image
+
+    /** event output **/
+    double event_threshold = 0.15;          // minimal log-intensity change for an event
+    const float event_eps = 1.f / 255.f;    // offset for the log-intensity to avoid log(0)
+    std::atomic<bool> event_ref_valid{false};    // flag, being true if the event reference frame is set
+    std::vector<float> event_frame;         // processed images for the event computation
+    std::vector<float> event_ref;           // log-intensity of each pixel at its last event
+
+    /** disparity output **/
+    cv::Ptr<cv::StereoMatcher> stereo_matcher;    // stereo matcher for the disparity output; set by SetDisparity
+    cv::Mat stereo_color[2];                      // 8 bit color images before the gray conversion (color output)
+    cv::Mat stereo_gray[2];                       // 8 bit gray images as matcher input -> index 0: right eye; 1: left eye
+    cv::Mat stereo_raw;                           // fixed-point disparity of the matcher (CV_16S, 4 fractional bits)
+
+    /** filter bank output **/
+    FilterBank filter_bank[2];                    // filter bank per eye, to filter both eyes in parallel -> index 0: right eye; 1: left eye
+    std::unique_ptr<ThreadPool> filter_pool;      // worker threads applying the filters of the bank in parallel
+    std::vector<float> filter_input[2];           // processed images (single precision) as filter input -> index 0: right eye; 1: left eye
+    cv::Mat filter_gray[2];                       // gray images of the color output as filter input
 
     /** grpc communication **/
 #ifdef _USE_GRPC
@@ -160,14 +373,30 @@ class VisualReader : public Mod_BaseClass {
 #endif
 
     /*** auxilary methods ***/
-    //
-    std::vector<precision> ProcessRead();
+    // return a camera image of the given eye (0: right; 1: left) from the camera source and keep the frame until the next call
+    const yarp::sig::ImageOf<yarp::sig::PixelRgb> *AcquireImage(int eye_idx);
+    // return the robot camera port of the given side ("right"/"left"), preferring the calibrated image port
+    std::string ResolveCameraPort(const std::string &side);
+    // load the camera intrinsics and distortion of the given eye (0: right; 1: left) from an iCub camera calibration file
+    bool LoadCameraCalibration(const std::string &calib_file, int eye_idx, std::vector<double> &intrinsics, std::vector<double> &distortion);
+    // run the read function for the selected eye(s), in binocular mode both eyes in parallel; the eye data is stored with the given stride in bytes
+    bool ReadEyes(const std::function<bool(int, uint8_t *)> &read_eye, uint8_t *buffer, size_t stride);
+    // compute the pyramid levels behind the processed image (output type)
+    void BuildPyramid(uint8_t *image);
+    // convert the processed image (output type) of the given eye to the 8 bit gray input of the stereo matcher
+    void StereoInput(int eye_idx, const uint8_t *image);
+    // check the filter bank preconditions, reset the filter bank of both eyes and start the filter worker threads
+    bool PrepareFilterBank();
+    // read the image of the given eye and write the filter responses into the output buffer
+    bool ReadEyeFiltered(int eye_idx, uint8_t *out);
+    // read the newest image of the given eye (0: right; 1: left) and write the preprocessed image with the given element type into the output buffer
+    bool ReadEye(int eye_idx, void *out, ImageDType dtype);
+    // preprocess the given camera image with the processor of the given eye and write the result with the given element type into the output buffer
+    void ProcessRead(int eye_idx, const yarp::sig::ImageOf<yarp::sig::PixelRgb> *image, void *out, ImageDType dtype);
     // convert field of view horizontal degree position to horizontal pixel position
-    double FovX2PixelX(double fx);
+    static double FovX2PixelX(double fx);
     // convert field of view vertical degree position to vertical pixel position
-    double FovY2PixelY(double fy);
-    // convert a 2D-matrix to 1D-vector
-    std::vector<precision> Mat2Vec(cv::Mat matrix);
-    std::vector<precision> MatC2Vec(cv::Mat matrix);
+    static double FovY2PixelY(double fy);
+    // convert a 3D-matrix to 1D-vector
     std::vector<uint8_t> Mat3D2Vec(cv::Mat matrix);
 };
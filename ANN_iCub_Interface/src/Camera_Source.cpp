@@ -0,0 +1,203 @@
+/*
+ *  Copyright (C) 2019-2024 Torsten Fietzek
+ *
+ *  Camera_Source.cpp is part of the ANNarchy iCub interface
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  The ANNarchy iCub interface is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this headers. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "Camera_Source.hpp"
+
+#include <yarp/os/all.h>
+#include <yarp/sig/all.h>
+
+#include <chrono>
+#include <ctime>
+#include <iostream>
+#include <memory>
+#include <mutex>
+#include <string>
+
+std::mutex CameraSource::registry_mutex;
+std::map<std::string, std::weak_ptr<CameraSource>> CameraSource::registry;
+
+std::shared_ptr<CameraSource> CameraSource::Subscribe(const std::string &robot_port, const std::string &client_port_prefix, const std::string &carrier) {
+    /*
+        Return the shared camera source for the given robot port; create and connect it, if no reader is subscribed yet or the
+        subscribed source stopped after a failed read (the stopped source stays with its current readers)
+
+        params: std::string robot_port              -- robot camera port name
+                std::string client_port_prefix      -- client port name prefix
+                std::string carrier                 -- YARP carrier of the connection; empty: YARP default
+
+        return: std::shared_ptr<CameraSource>       -- camera source; nullptr if the port could not be connected
+    */
+
+    static unsigned int reconnects = 0;    // number of replaced sources -> unique port name, the stopped source still holds its port
+
+    std::lock_guard<std::mutex> lock(registry_mutex);
+    auto source = registry[robot_port].lock();
+    if (source && source->running) {
+        if (source->carrier != carrier) {
+            std::cerr << "[Camera Source] " << robot_port << " is already connected with the carrier \"" << source->carrier << "\"; the connection is shared." << std::endl;
+        }
+        return source;
+    }
+
+    std::string port_name = client_port_prefix + "/V_Reader" + robot_port + "_" + std::to_string(std::time(NULL));
+    if (source) {
+        std::cerr << "[Camera Source] The camera source of " << robot_port << " was stopped; it is replaced by a new connection." << std::endl;
+        port_name += "_" + std::to_string(++reconnects);
+    }
+    port_name += ":i";
+    source = std::shared_ptr<CameraSource>(new CameraSource(robot_port, port_name, carrier));
+    if (!source->running) {
+        registry.erase(robot_port);
+        return nullptr;
+    }
+    registry[robot_port] = source;
+    return source;
+}
+
+CameraSource::CameraSource(const std::string &robot_port, const std::string &port_name, const std::string &carrier) : robot_port(robot_port), carrier(carrier) {
+    /*
+        Open and connect the receiving port and start the receiving thread
+
+        params: std::string robot_port      -- robot camera port name
+                std::string port_name       -- local port name
+                std::string carrier         -- YARP carrier of the connection; empty: YARP default
+    */
+
+    port.open(port_name);
+    if (!yarp::os::Network::connect(robot_port, port.getName(), carrier)) {
+        std::cerr << "[Camera Source] Could not connect to the camera port " << robot_port << (carrier.empty() ? "" : " with the carrier " + carrier) << "!" << std::endl;
+        port.close();
+        return;
+    }
+    running = true;
+    receive_thread = std::thread(&CameraSource::ReceiveLoop, this);
+}
+
+CameraSource::~CameraSource() {
+    /*
+        Stop the receiving thread; the blocking port read is interrupted
+    */
+
+    // the thread only runs, if the port was connected; it may have stopped already after a failed read
+    if (receive_thread.joinable()) {
+        Stop();
+        port.interrupt();
+        receive_thread.join();
+        yarp::os::Network::disconnect(robot_port, port.getName());
+        port.close();
+    }
+}
+
+std::shared_ptr<const CameraFrame> CameraSource::WaitFrame(unsigned long long sequence) {
+    /*
+        Return a frame with a higher sequence number than the given one; waits until such a frame is received
+
+        params: unsigned long long sequence         -- sequence number to compare with
+
+        return: std::shared_ptr<const CameraFrame>  -- frame; nullptr if the source was stopped
+    */
+
+    std::unique_lock<std::mutex> lock(frame_mutex);
+    frame_cond.wait(lock, [this, sequence] { return !running || (latest && latest->sequence > sequence); });
+    if (!running) {
+        return nullptr;
+    }
+    return latest;
+}
+
+unsigned long long CameraSource::LatestSequence() {
+    /*
+        Return the sequence number of the newest frame
+
+        return: unsigned long long      -- sequence number; 0 if no frame was received yet
+    */
+
+    std::lock_guard<std::mutex> lock(frame_mutex);
+    return latest ? latest->sequence : 0;
+}
+
+void CameraSource::ReceiveLoop() {
+    /*
+        Receive the camera images, copy them into a free frame and publish it as newest frame
+    */
+
+    unsigned long long sequence = 0;
+    yarp::os::Stamp stamp;
+
+    while (running) {
+        auto *img = port.read();
+        if (img == nullptr) {
+            // the port was interrupted or closed -> no further frames
+            if (running) {
+                std::cerr << "[Camera Source] Reading from the camera port " << robot_port << " failed; the camera source is stopped!" << std::endl;
+                Stop();
+            }
+            break;
+        }
+        auto frame = FreeFrame();
+        frame->image.copy(*img);
+        port.getEnvelope(stamp);
+        frame->timestamp = stamp.isValid() ? stamp.getTime() : yarp::os::Time::now();
+        frame->sequence = ++sequence;
+        {
+            std::lock_guard<std::mutex> lock(frame_mutex);
+            latest = frame;
+        }
+        frame_cond.notify_all();
+    }
+}
+
+std::shared_ptr<CameraFrame> CameraSource::FreeFrame() {
+    /*
+        Return a frame, which is not referenced anymore; allocate a new one, if all frames are in use
+
+        return: std::shared_ptr<CameraFrame>    -- frame for the next image
+    */
+
+    std::unique_ptr<CameraFrame> frame;
+    {
+        std::lock_guard<std::mutex> lock(frame_pool->mutex);
+        if (!frame_pool->free.empty()) {
+            frame = std::move(frame_pool->free.back());
+            frame_pool->free.pop_back();
+        }
+    }
+    if (!frame) {
+        frame = std::make_unique<CameraFrame>();
+    }
+
+    // the last owner (newest frame or a reader) puts the frame back into the free list
+    auto pool = frame_pool;
+    return std::shared_ptr<CameraFrame>(frame.release(), [pool](CameraFrame *released) {
+        std::lock_guard<std::mutex> lock(pool->mutex);
+        pool->free.emplace_back(released);
+    });
+}
+
+void CameraSource::Stop() {
+    /*
+        Stop the receiving thread and wake up the waiting readers; the flag is set under the frame mutex -> no missed wake up
+    */
+
+    {
+        std::lock_guard<std::mutex> lock(frame_mutex);
+        running = false;
+    }
+    frame_cond.notify_all();
+}
@@ -0,0 +1,190 @@
+/*
+ *  Copyright (C) 2019-2024 Torsten Fietzek
+ *
+ *  Filter_Bank.cpp is part of the ANNarchy iCub interface
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  The ANNarchy iCub interface is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this headers. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "Filter_Bank.hpp"
+
+#include <cmath>
+#include <future>
+#include <vector>
+
+bool FilterBank::InitGabor(int orientations, const std::vector<double> &wavelengths, const std::vector<double> &phases) {
+    /*
+        Compute a bank of oriented Gabor kernels; the maps are ordered by wavelength, orientation and phase
+
+        params: int orientations                -- number of orientations in [0°, 180°)
+                std::vector<double> wavelengths -- carrier wavelengths in pixel
+                std::vector<double> phases      -- carrier phase offsets in degree
+
+        return: bool                            -- return True, if the parameters are valid
+    */
+
+    Clear();
+    if (orientations < 1 || wavelengths.empty() || phases.empty()) {
+        return false;
+    }
+    for (auto lambda : wavelengths) {
+        if (lambda < 2.) {
+            return false;
+        }
+    }
+
+    const double gamma = 0.5;    // spatial aspect ratio of the envelope
+    for (auto lambda : wavelengths) {
+        // bandwidth of one octave; the kernel covers +-3 sigma of the envelope
+        double sigma = 0.56 * lambda;
+        int half = static_cast<int>(std::ceil(3. * sigma));
+        for (int o = 0; o < orientations; o++) {
+            double theta = CV_PI * o / orientations;
+            for (auto phase : phases) {
+                Filter filter;
+                filter.kernel = cv::getGaborKernel(cv::Size(2 * half + 1, 2 * half + 1), sigma, theta, lambda, gamma, phase * CV_PI / 180., CV_32F);
+                // no response to uniform regions; responses of all kernels in the same range
+                filter.kernel -= cv::mean(filter.kernel)[0];
+                double l1 = cv::norm(filter.kernel, cv::NORM_L1);
+                if (l1 > 0.) {
+                    filter.kernel /= l1;
+                }
+                filter.map_idx = n_maps++;
+                filters.push_back(filter);
+            }
+        }
+    }
+    return true;
+}
+
+bool FilterBank::InitDoG(const std::vector<double> &sigmas, double surround_ratio) {
+    /*
+        Set up a bank of ON/OFF difference-of-Gaussians; each scale writes an ON and an OFF map
+
+        params: std::vector<double> sigmas      -- center standard deviations in pixel
+                double surround_ratio           -- ratio of surround and center standard deviation
+
+        return: bool                            -- return True, if the parameters are valid
+    */
+
+    Clear();
+    if (sigmas.empty() || surround_ratio <= 1.) {
+        return false;
+    }
+    for (auto sigma : sigmas) {
+        if (sigma <= 0.) {
+            return false;
+        }
+    }
+
+    for (auto sigma : sigmas) {
+        Filter filter;
+        filter.sigma_center = sigma;
+        filter.sigma_surround = sigma * surround_ratio;
+        filter.map_idx = n_maps;
+        n_maps += 2;
+        filters.push_back(filter);
+    }
+    return true;
+}
+
+void FilterBank::Clear() {
+    /*
+        Remove all filters
+    */
+
+    filters.clear();
+    n_maps = 0;
+}
+
+void FilterBank::Apply(const cv::Mat &image, uint8_t *out, ImageDType dtype, ThreadPool *pool) {
+    /*
+        Apply the filter bank to the image; the filters are distributed on the worker pool, the last filter is applied by the calling thread
+
+        params: cv::Mat image           -- single channel image (CV_32F)
+                uint8_t *out            -- output buffer for Count() response maps of the given type
+                ImageDType dtype        -- element type of the output buffer
+                ThreadPool *pool        -- worker pool; nullptr for sequential filtering
+    */
+
+    if (filters.empty()) {
+        return;
+    }
+
+    std::vector<std::future<void>> pending;
+    if (pool != nullptr) {
+        pending.reserve(filters.size() - 1);
+        for (size_t i = 0; i < filters.size() - 1; i++) {
+            pending.push_back(pool->Submit([this, i, &image, out, dtype]() { ApplyFilter(filters[i], image, out, dtype); }));
+        }
+        ApplyFilter(filters.back(), image, out, dtype);
+        for (auto &task : pending) {
+            task.get();
+        }
+    } else {
+        for (auto &filter : filters) {
+            ApplyFilter(filter, image, out, dtype);
+        }
+    }
+}
+
+void FilterBank::ApplyFilter(Filter &filter, const cv::Mat &image, uint8_t *out, ImageDType dtype) {
+    /*
+        Apply a single filter and write its response map(s) into the output buffer
+
+        params: Filter &filter          -- filter of the bank
+                cv::Mat image           -- single channel image (CV_32F)
+                uint8_t *out            -- output buffer for the response maps
+                ImageDType dtype        -- element type of the output buffer
+    */
+
+    if (!filter.kernel.empty()) {
+        // OpenCV switches to the DFT based correlation for large kernels
+        cv::filter2D(image, filter.response, CV_32F, filter.kernel, cv::Point(-1, -1), 0., cv::BORDER_REFLECT);
+        StoreMap(filter.response, out, filter.map_idx, dtype, true);
+    } else {
+        // separable Gaussians; ON: center brighter than surround, OFF: center darker than surround
+        cv::GaussianBlur(image, filter.response, cv::Size(0, 0), filter.sigma_center, 0., cv::BORDER_REFLECT);
+        cv::GaussianBlur(image, filter.surround, cv::Size(0, 0), filter.sigma_surround, 0., cv::BORDER_REFLECT);
+        filter.response -= filter.surround;
+        cv::max(filter.response, 0., filter.surround);
+        StoreMap(filter.surround, out, filter.map_idx, dtype, false);
+        cv::min(filter.response, 0., filter.surround);
+        filter.surround *= -1.;
+        StoreMap(filter.surround, out, filter.map_idx + 1, dtype, false);
+    }
+}
+
+void FilterBank::StoreMap(const cv::Mat &response, uint8_t *out, int map_idx, ImageDType dtype, bool signed_map) {
+    /*
+        Convert a response map into the output map of the given type; for uint8 signed responses [-1, 1] are offset to 127.5 * (1 + r),
+        so that zero maps to the mid gray value and negative responses are not saturated; unsigned responses [0, 1] are scaled by 255
+
+        params: cv::Mat response        -- response map (CV_32F)
+                uint8_t *out            -- output buffer for the response maps
+                int map_idx             -- index of the response map in the output buffer
+                ImageDType dtype        -- element type of the output buffer
+                bool signed_map         -- true for signed responses (Gabor); false for rectified responses (DoG ON/OFF)
+    */
+
+    size_t map_bytes = response.total() * ImageDTypeSize(dtype);
+    cv::Mat map(response.rows, response.cols, ImageDTypeDepth(dtype), out + map_idx * map_bytes);
+    if (dtype != ImageDType::UINT8) {
+        response.convertTo(map, ImageDTypeDepth(dtype));
+    } else if (signed_map) {
+        response.convertTo(map, CV_8U, 127.5, 127.5);
+    } else {
+        response.convertTo(map, CV_8U, 255.);
+    }
+}
@@ -0,0 +1,823 @@
+/*
+ *  Copyright (C) 2019-2024 Torsten Fietzek
+ *
+ *  Image_Processor.cpp is part of the ANNarchy iCub interface
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  The ANNarchy iCub interface is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this headers. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "Image_Processor.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <iostream>
+#include <opencv2/opencv.hpp>
+#include <string>
+#include <vector>
+
+#if defined(__AVX2__) || defined(__SSE2__)
+#include <immintrin.h>
+#endif
+
+bool ParseImageDType(const std::string &name, ImageDType &dtype) {
+    /*
+        Return the element type for the given name
+
+        params: std::string name        -- name of the element type: uint8, float16, float32 or float64
+                ImageDType &dtype       -- element type
+
+        return: bool                    -- return True, if the name is valid
+    */
+
+    if (name == "uint8") {
+        dtype = ImageDType::UINT8;
+    } else if (name == "float16") {
+        dtype = ImageDType::FLOAT16;
+    } else if (name == "float32") {
+        dtype = ImageDType::FLOAT32;
+    } else if (name == "float64") {
+        dtype = ImageDType::FLOAT64;
+    } else {
+        return false;
+    }
+    return true;
+}
+
+size_t ImageDTypeSize(ImageDType dtype) {
+    /*
+        Return the size of one element of the given type
+
+        params: ImageDType dtype        -- element type
+
+        return: size_t                  -- element size in bytes
+    */
+
+    switch (dtype) {
+        case ImageDType::UINT8:
+            return sizeof(uint8_t);
+        case ImageDType::FLOAT16:
+            return sizeof(cv::float16_t);
+        case ImageDType::FLOAT32:
+            return sizeof(float);
+        case ImageDType::FLOAT64:
+            return sizeof(double);
+    }
+    return 0;
+}
+
+int ImageDTypeDepth(ImageDType dtype) {
+    /*
+        Return the OpenCV depth of the given element type
+
+        params: ImageDType dtype        -- element type
+
+        return: int                     -- OpenCV depth
+    */
+
+    switch (dtype) {
+        case ImageDType::UINT8:
+            return CV_8U;
+        case ImageDType::FLOAT16:
+            return CV_16F;
+        case ImageDType::FLOAT32:
+            return CV_32F;
+        case ImageDType::FLOAT64:
+            return CV_64F;
+    }
+    return -1;
+}
+
+/*
+    Row kernels of the single pass pipeline: explicit AVX2 (8 floats) or SSE2 (4 floats) code, selected at compile time (-march=native),
+    with a scalar loop for the remaining elements and for other platforms; accumulated pixel values are in the range [0., 255.]
+*/
+
+static void ConvertRow(const uint8_t *__restrict src, float *__restrict dst, int count) {
+    /*
+        Convert 8 bit values to float
+
+        params: const uint8_t *src      -- input values
+                float *dst              -- output values
+                int count               -- number of values
+    */
+
+    int i = 0;
+#if defined(__AVX2__)
+    for (; i + 8 <= count; i += 8) {
+        const __m256i v = _mm256_cvtepu8_epi32(_mm_loadl_epi64(reinterpret_cast<const __m128i *>(src + i)));
+        _mm256_storeu_ps(dst + i, _mm256_cvtepi32_ps(v));
+    }
+#elif defined(__SSE2__)
+    const __m128i zero = _mm_setzero_si128();
+    for (; i + 4 <= count; i += 4) {
+        int32_t bytes;
+        std::memcpy(&bytes, src + i, sizeof(bytes));
+        const __m128i v = _mm_unpacklo_epi16(_mm_unpacklo_epi8(_mm_cvtsi32_si128(bytes), zero), zero);
+        _mm_storeu_ps(dst + i, _mm_cvtepi32_ps(v));
+    }
+#endif
+    for (; i < count; i++) {
+        dst[i] = src[i];
+    }
+}
+
+static void GatherRow(const float *__restrict src, const int *__restrict index, const float *__restrict weight, int taps, int count, float *__restrict dst) {
+    /*
+        Horizontal resampling: weighted sum of the gathered source values for every output element
+
+        params: const float *src        -- color converted source row
+                const int *index        -- source index per tap and output element (taps x count)
+                const float *weight     -- weight per tap and output element (taps x count)
+                int taps                -- number of taps
+                int count               -- number of output elements
+                float *dst              -- resampled row
+    */
+
+    int i = 0;
+#if defined(__AVX2__)
+    for (; i + 8 <= count; i += 8) {
+        __m256 sum = _mm256_setzero_ps();
+        for (int k = 0; k < taps; k++) {
+            const __m256i idx = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(index + k * count + i));
+            const __m256 v = _mm256_i32gather_ps(src, idx, sizeof(float));
+            sum = _mm256_add_ps(sum, _mm256_mul_ps(_mm256_loadu_ps(weight + k * count + i), v));
+        }
+        _mm256_storeu_ps(dst + i, sum);
+    }
+#endif
+    for (; i < count; i++) {
+        float sum = 0.f;
+        for (int k = 0; k < taps; k++) {
+            sum += weight[k * count + i] * src[index[k * count + i]];
+        }
+        dst[i] = sum;
+    }
+}
+
+static void AccumulateRow(const float *__restrict row, float weight, float *__restrict acc, int count) {
+    /*
+        Vertical resampling: add the weighted resampled row to the accumulator
+
+        params: const float *row        -- horizontally resampled source row
+                float weight            -- weight of the source row
+                float *acc              -- accumulator for the output row
+                int count               -- number of elements
+    */
+
+    int i = 0;
+#if defined(__AVX2__)
+    const __m256 w = _mm256_set1_ps(weight);
+    for (; i + 8 <= count; i += 8) {
+        _mm256_storeu_ps(acc + i, _mm256_add_ps(_mm256_loadu_ps(acc + i), _mm256_mul_ps(w, _mm256_loadu_ps(row + i))));
+    }
+#elif defined(__SSE2__)
+    const __m128 w = _mm_set1_ps(weight);
+    for (; i + 4 <= count; i += 4) {
+        _mm_storeu_ps(acc + i, _mm_add_ps(_mm_loadu_ps(acc + i), _mm_mul_ps(w, _mm_loadu_ps(row + i))));
+    }
+#endif
+    for (; i < count; i++) {
+        acc[i] += weight * row[i];
+    }
+}
+
+// clamp an accumulated value to [0., 255.] -> bicubic interpolation overshoots at edges, the staged pipeline saturates the 8 bit image
+static inline float ClampPixel(float value) { return std::min(std::max(value, 0.f), 255.f); }
+
+static void StoreRow(const float *__restrict acc, float scale, float *__restrict out, int count) {
+    /*
+        Clamp and normalize the accumulated row to [0., 1.]
+
+        params: const float *acc        -- accumulated row
+                float scale             -- normalization factor
+                float *out              -- output row
+                int count               -- number of elements
+    */
+
+    int i = 0;
+#if defined(__AVX2__)
+    const __m256 lo = _mm256_setzero_ps(), hi = _mm256_set1_ps(255.f), s = _mm256_set1_ps(scale);
+    for (; i + 8 <= count; i += 8) {
+        const __m256 v = _mm256_min_ps(_mm256_max_ps(_mm256_loadu_ps(acc + i), lo), hi);
+        _mm256_storeu_ps(out + i, _mm256_mul_ps(v, s));
+    }
+#elif defined(__SSE2__)
+    const __m128 lo = _mm_setzero_ps(), hi = _mm_set1_ps(255.f), s = _mm_set1_ps(scale);
+    for (; i + 4 <= count; i += 4) {
+        const __m128 v = _mm_min_ps(_mm_max_ps(_mm_loadu_ps(acc + i), lo), hi);
+        _mm_storeu_ps(out + i, _mm_mul_ps(v, s));
+    }
+#endif
+    for (; i < count; i++) {
+        out[i] = ClampPixel(acc[i]) * scale;
+    }
+}
+
+static void StoreRow(const float *__restrict acc, float scale, double *__restrict out, int count) {
+    /*
+        Clamp and normalize the accumulated row to [0., 1.]
+
+        params: const float *acc        -- accumulated row
+                float scale             -- normalization factor
+                double *out             -- output row
+                int count               -- number of elements
+    */
+
+    int i = 0;
+#if defined(__AVX2__)
+    const __m256 lo = _mm256_setzero_ps(), hi = _mm256_set1_ps(255.f), s = _mm256_set1_ps(scale);
+    for (; i + 8 <= count; i += 8) {
+        const __m256 v = _mm256_mul_ps(_mm256_min_ps(_mm256_max_ps(_mm256_loadu_ps(acc + i), lo), hi), s);
+        _mm256_storeu_pd(out + i, _mm256_cvtps_pd(_mm256_castps256_ps128(v)));
+        _mm256_storeu_pd(out + i + 4, _mm256_cvtps_pd(_mm256_extractf128_ps(v, 1)));
+    }
+#elif defined(__SSE2__)
+    const __m128 lo = _mm_setzero_ps(), hi = _mm_set1_ps(255.f), s = _mm_set1_ps(scale);
+    for (; i + 4 <= count; i += 4) {
+        const __m128 v = _mm_mul_ps(_mm_min_ps(_mm_max_ps(_mm_loadu_ps(acc + i), lo), hi), s);
+        _mm_storeu_pd(out + i, _mm_cvtps_pd(v));
+        _mm_storeu_pd(out + i + 2, _mm_cvtps_pd(_mm_movehl_ps(v, v)));
+    }
+#endif
+    for (; i < count; i++) {
+        out[i] = ClampPixel(acc[i]) * scale;
+    }
+}
+
+static void StoreRow(const float *__restrict acc, float scale, cv::float16_t *__restrict out, int count) {
+    /*
+        Clamp and normalize the accumulated row to [0., 1.] (scalar conversion to half precision)
+
+        params: const float *acc        -- accumulated row
+                float scale             -- normalization factor
+                cv::float16_t *out      -- output row
+                int count               -- number of elements
+    */
+
+    for (int i = 0; i < count; i++) {
+        out[i] = cv::float16_t(ClampPixel(acc[i]) * scale);
+    }
+}
+
+static void StoreRow(const float *__restrict acc, float, uint8_t *__restrict out, int count) {
+    /*
+        Round and saturate the accumulated row to 8 bit (round half to even like cv::saturate_cast)
+
+        params: const float *acc        -- accumulated row
+                uint8_t *out            -- output row
+                int count               -- number of elements
+    */
+
+    int i = 0;
+#if defined(__AVX2__)
+    for (; i + 8 <= count; i += 8) {
+        const __m256i v = _mm256_cvtps_epi32(_mm256_loadu_ps(acc + i));
+        const __m128i v16 = _mm_packs_epi32(_mm256_castsi256_si128(v), _mm256_extracti128_si256(v, 1));
+        _mm_storel_epi64(reinterpret_cast<__m128i *>(out + i), _mm_packus_epi16(v16, v16));
+    }
+#elif defined(__SSE2__)
+    for (; i + 4 <= count; i += 4) {
+        const __m128i v = _mm_cvtps_epi32(_mm_loadu_ps(acc + i));
+        const __m128i v16 = _mm_packs_epi32(v, v);
+        const int32_t bytes = _mm_cvtsi128_si32(_mm_packus_epi16(v16, v16));
+        std::memcpy(out + i, &bytes, sizeof(bytes));
+    }
+#endif
+    for (; i < count; i++) {
+        out[i] = cv::saturate_cast<uint8_t>(acc[i]);
+    }
+}
+
+template <typename T>
+double ImageProcessor::StoreScale() const {
+    return norm_fact;
+}
+
+template <>
+double ImageProcessor::StoreScale<uint8_t>() const {
+    return 1.;
+}
+
+bool ImageProcessor::Init(int in_width, int in_height, cv::Rect rov, int out_width, int out_height, bool gray, int filter) {
+    /*
+        Compute the resampling tables for the given image geometry
+
+        params: int in_width, in_height     -- input image size in pixel
+                cv::Rect rov                -- region of view in the input image
+                int out_width, out_height   -- output image size in pixel
+                bool gray                   -- True for grayscale output; False for BGR output
+                int filter                  -- interpolation flag for upscaling
+
+        return: bool                        -- return True, if the geometry is valid
+    */
+
+    if (rov.x < 0 || rov.y < 0 || rov.width <= 0 || rov.height <= 0 || rov.x + rov.width > in_width || rov.y + rov.height > in_height) {
+        std::cerr << "[Image Processor] Region of view is outside of the input image!" << std::endl;
+        return false;
+    }
+    if (out_width <= 0 || out_height <= 0) {
+        std::cerr << "[Image Processor] Output image size has to be positive!" << std::endl;
+        return false;
+    }
+
+    this->in_width = in_width;
+    this->in_height = in_height;
+    this->rov = rov;
+    this->out_width = out_width;
+    this->out_height = out_height;
+    this->out_channels = gray ? 1 : 3;
+    this->filter = filter;
+    this->layout = ImageLayout::CARTESIAN;
+
+    // same rule for both axes as the staged pipeline: INTER_AREA, if any axis is downscaled (cv::resize falls back to its bilinear
+    // pixel area relation, if the other axis is upscaled); otherwise the interpolation flag
+    Resampling method;
+    if (rov.width > out_width || rov.height > out_height) {
+        method = (rov.width >= out_width && rov.height >= out_height) ? Resampling::AREA : Resampling::AREA_LINEAR;
+    } else {
+        method = (filter == cv::INTER_CUBIC) ? Resampling::CUBIC : Resampling::LINEAR;
+    }
+    table_x = ComputeTable(rov.width, out_width, rov.x, method);
+    table_y = ComputeTable(rov.height, out_height, rov.y, method);
+
+    // expand the horizontal table to the interleaved output row (RGB source -> BGR output) in tap-major order -> contiguous vector loads per tap
+    const int row_len = out_width * out_channels;
+    gather_index.resize(static_cast<size_t>(table_x.taps) * row_len);
+    gather_weight.resize(static_cast<size_t>(table_x.taps) * row_len);
+    for (int dx = 0; dx < out_width; dx++) {
+        for (int k = 0; k < table_x.taps; k++) {
+            const int sx = table_x.index[dx * table_x.taps + k] - rov.x;
+            for (int c = 0; c < out_channels; c++) {
+                const size_t j = static_cast<size_t>(k) * row_len + dx * out_channels + c;
+                gather_index[j] = gray ? sx : 3 * sx + (2 - c);
+                gather_weight[j] = table_x.weight[dx * table_x.taps + k];
+            }
+        }
+    }
+    color_row.assign(static_cast<size_t>(rov.width) * out_channels, 0.f);
+
+    // consecutive output rows share source rows -> keep the last horizontally resampled rows
+    cache_slots = table_y.taps + 1;
+    row_cache.assign(static_cast<size_t>(cache_slots) * out_width * out_channels, 0.f);
+    row_tag.assign(cache_slots, -1);
+    acc_row.assign(static_cast<size_t>(out_width) * out_channels, 0.f);
+
+    // with undistortion the pixel centers of the output image are sampled with one remap table
+    if (undistort) {
+        cv::Mat map_x(out_height, out_width, CV_32FC1), map_y(out_height, out_width, CV_32FC1);
+        const double scale_x = static_cast<double>(rov.width) / out_width;
+        const double scale_y = static_cast<double>(rov.height) / out_height;
+        for (int y = 0; y < out_height; y++) {
+            float *mx = map_x.ptr<float>(y);
+            float *my = map_y.ptr<float>(y);
+            for (int x = 0; x < out_width; x++) {
+                mx[x] = static_cast<float>(rov.x + (x + 0.5) * scale_x - 0.5);
+                my[x] = static_cast<float>(rov.y + (y + 0.5) * scale_y - 0.5);
+            }
+        }
+        BuildRemap(map_x, map_y);
+    }
+    return true;
+}
+
+bool ImageProcessor::InitLogPolar(int in_width, int in_height, cv::Rect rov, int rings, int wedges, double fovea_radius, bool gray) {
+    /*
+        Compute the remap table for the log-polar retina layout
+
+        params: int in_width, in_height     -- input image size in pixel
+                cv::Rect rov                -- region of view in the input image
+                int rings                   -- number of rings (output image height)
+                int wedges                  -- number of wedges (output image width)
+                double fovea_radius         -- radius of the linearly sampled fovea in input pixel
+                bool gray                   -- True for grayscale output; False for BGR output
+
+        return: bool                        -- return True, if the geometry is valid
+    */
+
+    if (rov.x < 0 || rov.y < 0 || rov.width <= 0 || rov.height <= 0 || rov.x + rov.width > in_width || rov.y + rov.height > in_height) {
+        std::cerr << "[Image Processor] Region of view is outside of the input image!" << std::endl;
+        return false;
+    }
+    const double max_radius = std::min(rov.width, rov.height) / 2.;
+    if (rings < 2 || wedges < 1) {
+        std::cerr << "[Image Processor] Log-polar layout needs at least 2 rings and 1 wedge!" << std::endl;
+        return false;
+    }
+    if (fovea_radius <= 0. || fovea_radius >= max_radius) {
+        std::cerr << "[Image Processor] Fovea radius has to be in (0, " << max_radius << ") pixel!" << std::endl;
+        return false;
+    }
+
+    this->in_width = in_width;
+    this->in_height = in_height;
+    this->rov = rov;
+    this->out_width = wedges;
+    this->out_height = rings;
+    this->out_channels = gray ? 1 : 3;
+    this->fovea_radius = fovea_radius;
+    this->layout = ImageLayout::LOG_POLAR;
+
+    // split the rings, so that the ring spacing is continuous at the fovea border:
+    // log rings have a spacing of fovea_radius * q / log_rings at the border, the fovea rings of fovea_radius / fovea_rings
+    const double q = std::log(max_radius / fovea_radius);
+    const int fovea_rings = std::min(std::max(static_cast<int>(std::round(rings / (1. + q))), 1), rings - 1);
+    const int log_rings = rings - fovea_rings;
+
+    const double cx = rov.x + (rov.width - 1) / 2.;
+    const double cy = rov.y + (rov.height - 1) / 2.;
+
+    cv::Mat map_x(rings, wedges, CV_32FC1), map_y(rings, wedges, CV_32FC1);
+    for (int r = 0; r < rings; r++) {
+        double radius;
+        if (r < fovea_rings) {
+            radius = fovea_radius * (r + 0.5) / fovea_rings;
+        } else {
+            radius = fovea_radius * std::exp(q * (r - fovea_rings + 0.5) / log_rings);
+        }
+        float *mx = map_x.ptr<float>(r);
+        float *my = map_y.ptr<float>(r);
+        for (int w = 0; w < wedges; w++) {
+            const double theta = 2. * M_PI * (w + 0.5) / wedges;
+            mx[w] = static_cast<float>(cx + radius * std::cos(theta));
+            my[w] = static_cast<float>(cy - radius * std::sin(theta));
+        }
+    }
+    BuildRemap(map_x, map_y);
+    return true;
+}
+
+bool ImageProcessor::SetRegionOfView(cv::Rect rov) {
+    /*
+        Move the region of view and recompute the tables for the initialized layout and output geometry
+
+        params: cv::Rect rov                -- new region of view in the input image
+
+        return: bool                        -- return True, if the geometry is valid
+    */
+
+    // both initializations check the geometry before changing the tables
+    if (layout == ImageLayout::LOG_POLAR) {
+        return InitLogPolar(in_width, in_height, rov, out_height, out_width, fovea_radius, out_channels == 1);
+    }
+    return Init(in_width, in_height, rov, out_width, out_height, out_channels == 1, filter);
+}
+
+bool ImageProcessor::SetUndistortion(const std::vector<double> &intrinsics, const std::vector<double> &distortion) {
+    /*
+        Enable the lens undistortion and recompute the remap table for the initialized geometry
+
+        params: std::vector<double> intrinsics      -- fx, fy, cx, cy in input pixel
+                std::vector<double> distortion      -- k1, k2, p1, p2, k3
+
+        return: bool                                -- return True, if the calibration is valid
+    */
+
+    if (intrinsics.size() != 4 || distortion.size() != 5 || intrinsics[0] <= 0. || intrinsics[1] <= 0.) {
+        std::cerr << "[Image Processor] Camera calibration needs positive focal lengths, the principal point and 5 distortion coefficients!" << std::endl;
+        return false;
+    }
+    this->intrinsics = intrinsics;
+    this->distortion = distortion;
+    this->undistort = true;
+    return SetRegionOfView(rov);
+}
+
+void ImageProcessor::BuildRemap(cv::Mat &map_x, cv::Mat &map_y) {
+    /*
+        Apply the lens distortion to the ideal sample positions and convert them into the fixed point remap table
+
+        params: cv::Mat map_x, map_y    -- ideal (undistorted) sample positions in input pixel (CV_32FC1); distorted in place
+    */
+
+    if (undistort) {
+        const double fx = intrinsics[0], fy = intrinsics[1], cx = intrinsics[2], cy = intrinsics[3];
+        const double k1 = distortion[0], k2 = distortion[1], p1 = distortion[2], p2 = distortion[3], k3 = distortion[4];
+        for (int r = 0; r < map_x.rows; r++) {
+            float *mx = map_x.ptr<float>(r);
+            float *my = map_y.ptr<float>(r);
+            for (int c = 0; c < map_x.cols; c++) {
+                // radial-tangential model on normalized camera coordinates
+                const double x = (mx[c] - cx) / fx;
+                const double y = (my[c] - cy) / fy;
+                const double r2 = x * x + y * y;
+                const double radial = 1. + r2 * (k1 + r2 * (k2 + r2 * k3));
+                mx[c] = static_cast<float>(fx * (x * radial + 2. * p1 * x * y + p2 * (r2 + 2. * x * x)) + cx);
+                my[c] = static_cast<float>(fy * (y * radial + p1 * (r2 + 2. * y * y) + 2. * p2 * x * y) + cy);
+            }
+        }
+    }
+    // fixed point maps are faster to apply than the floating point maps; new buffers -> a copied processor keeps its own tables
+    remap_map1.release();
+    remap_map2.release();
+    cv::convertMaps(map_x, map_y, remap_map1, remap_map2, CV_16SC2);
+}
+
+bool ImageProcessor::Process(const uint8_t *rgb, int width, int height, size_t row_step, void *out, ImageDType dtype) {
+    /*
+        Process the RGB image in a single pass with the output element type selected at runtime
+
+        params: const uint8_t *rgb      -- interleaved RGB image data
+                int width, height       -- image size in pixel
+                size_t row_step         -- number of bytes per image row
+                void *out               -- output buffer
+                ImageDType dtype        -- element type of the output buffer
+
+        return: bool                    -- return True, if successful
+    */
+
+    switch (dtype) {
+        case ImageDType::UINT8:
+            return Process(rgb, width, height, row_step, static_cast<uint8_t *>(out));
+        case ImageDType::FLOAT16:
+            return Process(rgb, width, height, row_step, static_cast<cv::float16_t *>(out));
+        case ImageDType::FLOAT32:
+            return Process(rgb, width, height, row_step, static_cast<float *>(out));
+        case ImageDType::FLOAT64:
+            return Process(rgb, width, height, row_step, static_cast<double *>(out));
+    }
+    return false;
+}
+
+void ImageProcessor::ProcessStaged(const uint8_t *rgb, int width, int height, size_t row_step, void *out, ImageDType dtype) {
+    /*
+        Process the RGB image with the multi-stage OpenCV pipeline with the output element type selected at runtime
+
+        params: const uint8_t *rgb      -- interleaved RGB image data
+                int width, height       -- image size in pixel
+                size_t row_step         -- number of bytes per image row
+                void *out               -- output buffer
+                ImageDType dtype        -- element type of the output buffer
+    */
+
+    switch (dtype) {
+        case ImageDType::UINT8:
+            ProcessStaged(rgb, width, height, row_step, static_cast<uint8_t *>(out));
+            break;
+        case ImageDType::FLOAT16:
+            ProcessStaged(rgb, width, height, row_step, static_cast<cv::float16_t *>(out));
+            break;
+        case ImageDType::FLOAT32:
+            ProcessStaged(rgb, width, height, row_step, static_cast<float *>(out));
+            break;
+        case ImageDType::FLOAT64:
+            ProcessStaged(rgb, width, height, row_step, static_cast<double *>(out));
+            break;
+    }
+}
+
+template <typename T>
+bool ImageProcessor::Process(const uint8_t *rgb, int width, int height, size_t row_step, T *out) {
+    /*
+        Process the RGB image in a single pass: color conversion, crop and resampling are done with the precomputed tables
+        and the result is converted to the output type and written once into the output buffer
+
+        params: const uint8_t *rgb      -- interleaved RGB image data
+                int width, height       -- image size in pixel
+                size_t row_step         -- number of bytes per image row
+                T *out                  -- output buffer
+
+        return: bool                    -- return True, if successful
+    */
+
+    if (UseRemap()) {
+        return ProcessRemap(rgb, width, height, row_step, out);
+    }
+    if (width != in_width || height != in_height) {
+        return false;
+    }
+
+    const int row_len = out_width * out_channels;
+    const int taps = table_y.taps;
+    std::fill(row_tag.begin(), row_tag.end(), -1);
+
+    for (int dy = 0; dy < out_height; dy++) {
+        std::fill(acc_row.begin(), acc_row.end(), 0.f);
+        float *acc = acc_row.data();
+
+        // vertical resampling of the horizontally resampled rows
+        for (int t = 0; t < taps; t++) {
+            const float wy = table_y.weight[dy * taps + t];
+            if (wy == 0.f) {
+                continue;
+            }
+            const int sy = table_y.index[dy * taps + t];
+            AccumulateRow(ResampleRow(rgb + sy * row_step, sy), wy, acc, row_len);
+        }
+
+        // clamp, convert (normalize) and write the output row
+        StoreRow(acc, norm_fact, out + static_cast<size_t>(dy) * row_len, row_len);
+    }
+    return true;
+}
+
+template <typename T>
+void ImageProcessor::ProcessStaged(const uint8_t *rgb, int width, int height, size_t row_step, T *out) {
+    /*
+        Process the RGB image with the multi-stage OpenCV pipeline -> reference for the single pass implementation
+
+        params: const uint8_t *rgb      -- interleaved RGB image data
+                int width, height       -- image size in pixel
+                size_t row_step         -- number of bytes per image row
+                T *out                  -- output buffer
+    */
+
+    if (UseRemap()) {
+        ProcessRemap(rgb, width, height, row_step, out);
+        return;
+    }
+
+    cv::Mat rgb_mat(height, width, CV_8UC3, const_cast<uint8_t *>(rgb), row_step);
+    cv::cvtColor(rgb_mat, color_mat, (out_channels == 1) ? cv::COLOR_RGB2GRAY : cv::COLOR_RGB2BGR);
+
+    // extracting the output part of the field of view
+    cv::Mat rov_mat = color_mat(rov);
+
+    // resize ROV to given output resolution
+    if (rov.width == out_width && rov.height == out_height) {
+        scaled_mat = rov_mat;
+    } else if (rov.width > out_width || rov.height > out_height) {
+        cv::resize(rov_mat, scaled_mat, cv::Size(out_width, out_height), 0, 0, cv::INTER_AREA);
+    } else {
+        cv::resize(rov_mat, scaled_mat, cv::Size(out_width, out_height), 0, 0, filter);
+    }
+
+    // convert the image to the output type (floating point: normalize from 0..255 to 0..1.0) directly into the output buffer
+    cv::Mat out_mat(out_height, out_width, CV_MAKETYPE(cv::DataType<T>::depth, out_channels), out);
+    scaled_mat.convertTo(out_mat, out_mat.type(), StoreScale<T>());
+}
+
+template <typename T>
+bool ImageProcessor::ProcessRemap(const uint8_t *rgb, int width, int height, size_t row_step, T *out) {
+    /*
+        Sample the image with the precomputed remap table (log-polar retina, undistortion + crop + scaling);
+        color conversion and type conversion are applied to the sampled image only
+
+        params: const uint8_t *rgb      -- interleaved RGB image data
+                int width, height       -- image size in pixel
+                size_t row_step         -- number of bytes per image row
+                T *out                  -- output buffer
+
+        return: bool                    -- return True, if successful
+    */
+
+    cv::Mat rgb_mat(height, width, CV_8UC3, const_cast<uint8_t *>(rgb), row_step);
+    cv::remap(rgb_mat, remap_mat, remap_map1, remap_map2, cv::INTER_LINEAR, cv::BORDER_REPLICATE);
+    cv::cvtColor(remap_mat, color_mat, (out_channels == 1) ? cv::COLOR_RGB2GRAY : cv::COLOR_RGB2BGR);
+
+    cv::Mat out_mat(out_height, out_width, CV_MAKETYPE(cv::DataType<T>::depth, out_channels), out);
+    color_mat.convertTo(out_mat, out_mat.type(), StoreScale<T>());
+    return true;
+}
+
+ImageProcessor::ResampleTable ImageProcessor::ComputeTable(int rov_size, int out_size, int offset, Resampling method) {
+    /*
+        Compute the resampling table for one image axis with the coefficients of cv::resize
+
+        params: int rov_size        -- size of the region of view along the axis
+                int out_size        -- output size along the axis
+                int offset          -- position of the region of view in the input image
+                Resampling method   -- resampling method of the image
+
+        return: ResampleTable       -- source indices and weights for every output pixel
+    */
+
+    ResampleTable table;
+    const double scale = static_cast<double>(rov_size) / out_size;    // source pixels per output pixel
+
+    auto clamp = [rov_size](int idx) { return std::min(std::max(idx, 0), rov_size - 1); };
+
+    if (rov_size == out_size) {    // identity
+        table.taps = 1;
+        table.index.resize(out_size);
+        table.weight.assign(out_size, 1.f);
+        for (int d = 0; d < out_size; d++) {
+            table.index[d] = offset + d;
+        }
+    } else if (method == Resampling::AREA) {    // area averaging
+        // largest number of source pixels covered by one output pixel -> no zero weighted taps for integer scale factors
+        for (int d = 0; d < out_size; d++) {
+            const int covered = static_cast<int>(std::ceil((d + 1) * scale)) - static_cast<int>(std::floor(d * scale));
+            table.taps = std::max(table.taps, covered);
+        }
+        table.index.resize(out_size * table.taps);
+        table.weight.resize(out_size * table.taps);
+        for (int d = 0; d < out_size; d++) {
+            const double s0 = d * scale;
+            const double s1 = (d + 1) * scale;
+            const int first = static_cast<int>(std::floor(s0));
+            for (int k = 0; k < table.taps; k++) {
+                const int s = first + k;
+                const double overlap = std::min(s1, s + 1.) - std::max(s0, static_cast<double>(s));
+                table.index[d * table.taps + k] = offset + clamp(s);
+                table.weight[d * table.taps + k] = (overlap > 0. && s < rov_size) ? static_cast<float>(overlap / scale) : 0.f;
+            }
+        }
+    } else if (method == Resampling::CUBIC) {    // bicubic interpolation (same coefficients as OpenCV)
+        const double A = -0.75;
+        table.taps = 4;
+        table.index.resize(out_size * table.taps);
+        table.weight.resize(out_size * table.taps);
+        for (int d = 0; d < out_size; d++) {
+            const double fx = (d + 0.5) * scale - 0.5;
+            const int s = static_cast<int>(std::floor(fx));
+            const double f = fx - s;
+            double w[4];
+            w[0] = ((A * (f + 1) - 5 * A) * (f + 1) + 8 * A) * (f + 1) - 4 * A;
+            w[1] = ((A + 2) * f - (A + 3)) * f * f + 1;
+            w[2] = ((A + 2) * (1 - f) - (A + 3)) * (1 - f) * (1 - f) + 1;
+            w[3] = 1. - w[0] - w[1] - w[2];
+            for (int k = 0; k < 4; k++) {
+                table.index[d * 4 + k] = offset + clamp(s - 1 + k);
+                table.weight[d * 4 + k] = static_cast<float>(w[k]);
+            }
+        }
+    } else {    // bilinear interpolation
+        table.taps = 2;
+        table.index.resize(out_size * table.taps);
+        table.weight.resize(out_size * table.taps);
+        const double inv_scale = static_cast<double>(out_size) / rov_size;
+        for (int d = 0; d < out_size; d++) {
+            int s;
+            double f;
+            if (method == Resampling::AREA_LINEAR) {
+                // pixel area relation of cv::resize (INTER_AREA with an upscaled axis); OpenCV derives the scale from the inverse and
+                // rounds the fraction to single precision -> same source pixel, if the fraction is close to 1
+                s = static_cast<int>(std::floor(d * (1. / inv_scale)));
+                const float fs = static_cast<float>((d + 1) - (s + 1) * inv_scale);
+                f = (fs <= 0.f) ? 0. : fs - std::floor(fs);
+            } else {
+                const double fx = (d + 0.5) * scale - 0.5;
+                s = static_cast<int>(std::floor(fx));
+                f = fx - s;
+            }
+            if (s < 0) {
+                s = 0;
+                f = 0.;
+            } else if (s >= rov_size - 1) {
+                s = rov_size - 1;
+                f = 0.;
+            }
+            table.index[d * 2] = offset + s;
+            table.index[d * 2 + 1] = offset + clamp(s + 1);
+            table.weight[d * 2] = static_cast<float>(1. - f);
+            table.weight[d * 2 + 1] = static_cast<float>(f);
+        }
+    }
+    return table;
+}
+
+const float *ImageProcessor::ResampleRow(const uint8_t *src_row, int row) {
+    /*
+        Return the horizontally resampled and color converted source row; rows are cached, since they are shared by consecutive output rows
+
+        params: const uint8_t *src_row  -- pointer to the RGB source row
+                int row                 -- source row index
+
+        return: const float *           -- resampled row (gray: out_width; BGR: 3 x out_width values)
+    */
+
+    const int slot = row % cache_slots;
+    float *dst = row_cache.data() + static_cast<size_t>(slot) * out_width * out_channels;
+    if (row_tag[slot] == row) {
+        return dst;
+    }
+    row_tag[slot] = row;
+
+    // gray image without horizontal scaling -> the converted row is already the resampled row
+    const uint8_t *p = src_row + 3 * rov.x;
+    float *src = (out_channels == 1 && rov.width == out_width) ? dst : color_row.data();
+    if (out_channels == 1) {
+        // RGB -> gray in the fixed point arithmetic of cv::COLOR_RGB2GRAY for 8 bit images (0.299, 0.587, 0.114 in 15 bit; OpenCV 4) -> same rounding as the staged pipeline
+        for (int x = 0; x < rov.width; x++, p += 3) {
+            src[x] = static_cast<float>((p[0] * 9798 + p[1] * 19235 + p[2] * 3735 + (1 << 14)) >> 15);
+        }
+    } else {
+        ConvertRow(p, src, 3 * rov.width);
+    }
+    if (src != dst) {
+        GatherRow(src, gather_index.data(), gather_weight.data(), table_x.taps, out_width * out_channels, dst);
+    }
+    return dst;
+}
+
+// explicit instantiation for the supported output element types
+template bool ImageProcessor::Process<uint8_t>(const uint8_t *, int, int, size_t, uint8_t *);
+template bool ImageProcessor::Process<cv::float16_t>(const uint8_t *, int, int, size_t, cv::float16_t *);
+template bool ImageProcessor::Process<float>(const uint8_t *, int, int, size_t, float *);
+template bool ImageProcessor::Process<double>(const uint8_t *, int, int, size_t, double *);
+template void ImageProcessor::ProcessStaged<uint8_t>(const uint8_t *, int, int, size_t, uint8_t *);
+template void ImageProcessor::ProcessStaged<cv::float16_t>(const uint8_t *, int, int, size_t, cv::float16_t *);
+template void ImageProcessor::ProcessStaged<float>(const uint8_t *, int, int, size_t, float *);
+template void ImageProcessor::ProcessStaged<double>(const uint8_t *, int, int, size_t, double *);
@@ -20,13 +20,20 @@
 #include "Joint_Reader.hpp"
 
 #include <yarp/dev/all.h>
+#include <yarp/dev/impl/jointData.h>
 #include <yarp/os/all.h>
 #include <yarp/sig/all.h>
 
 #include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
 #include <ctime>
 #include <iostream>
+#include <limits>
 #include <map>
+#include <random>
 #include <string>
 #include <thread>
 #include <vector>
@@ -38,11 +45,89 @@
 #include "ProvideInputServer.h"
 #endif
 
+bool ParsePopCoding(const std::string &name, PopCoding &coding) {
+    /*
+        Return the population coding for the given name
+
+        params: std::string name        -- name of the population coding: gaussian, von_mises or thermometer
+                PopCoding &coding       -- population coding
+
+        return: bool                    -- return True, if the name is valid
+    */
+
+    if (name == "gaussian") {
+        coding = PopCoding::GAUSSIAN;
+    } else if (name == "von_mises") {
+        coding = PopCoding::VON_MISES;
+    } else if (name == "thermometer") {
+        coding = PopCoding::THERMOMETER;
+    } else {
+        return false;
+    }
+    return true;
+}
+
+static uint64_t RandomSeed() {
+    /*
+        Return a nonzero seed for the xorshift generators
+
+        return: uint64_t                -- seed from std::random_device
+    */
+
+    std::random_device device;
+    uint64_t seed = (static_cast<uint64_t>(device()) << 32) ^ device();
+    return seed | 1;
+}
+
+static double UniformRandom() {
+    /*
+        Return a uniform random number from a xorshift128+ generator; every thread has its own generator -> no locking
+
+        return: double                  -- random number in [0, 1)
+    */
+
+    thread_local uint64_t state[2] = {RandomSeed(), RandomSeed()};
+    uint64_t s1 = state[0];
+    const uint64_t s0 = state[1];
+    state[0] = s0;
+    s1 ^= s1 << 23;
+    state[1] = s1 ^ s0 ^ (s1 >> 18) ^ (s0 >> 5);
+    // upper 53 bits -> double in [0, 1)
+    return static_cast<double>((state[1] + s0) >> 11) * (1. / 9007199254740992.);
+}
+
+JointStateCallback::JointStateCallback(yarp::os::BufferedPort<yarp::dev::impl::jointData> &port, SeqLock &state, int joints)
+    : port(port), state(state), joints(joints), sample(3 * joints, 0.) {}
+
+void JointStateCallback::onRead(yarp::dev::impl::jointData &data) {
+    /*
+        Decode a state message of the control board and publish positions, velocities and accelerations as one sample;
+        values, which are not provided by the control board, stay zero
+
+        params: jointData data          -- state message of the control board
+    */
+
+    if (!data.jointPosition_isValid || static_cast<int>(data.jointPosition.size()) != joints) {
+        return;
+    }
+    std::copy(data.jointPosition.data(), data.jointPosition.data() + joints, sample.begin());
+    if (data.jointVelocity_isValid && static_cast<int>(data.jointVelocity.size()) == joints) {
+        std::copy(data.jointVelocity.data(), data.jointVelocity.data() + joints, sample.begin() + joints);
+    }
+    if (data.jointAcceleration_isValid && static_cast<int>(data.jointAcceleration.size()) == joints) {
+        std::copy(data.jointAcceleration.data(), data.jointAcceleration.data() + joints, sample.begin() + 2 * joints);
+    }
+
+    yarp::os::Stamp stamp;
+    port.getEnvelope(stamp);
+    state.Write(sample.data(), stamp.isValid() ? stamp.getTime() : yarp::os::Time::now());
+}
+
 // Destructor
 JointReader::~JointReader() { Close(); }
 
 /*** public methods for the user ***/
-bool JointReader::Init(std::string part, double sigma, unsigned int pop_size, double deg_per_neuron, std::string ini_path) {
+bool JointReader::Init(std::string part, double sigma, unsigned int pop_size, double deg_per_neuron, std::string ini_path, std::string carrier, std::string coding) {
     /*
         Initialize the joint reader with given parameters
 
@@ -51,6 +136,8 @@ bool JointReader::Init(std::string part, double sigma, unsigned int pop_size, do
                 int pop_size            -- number of neurons per population, encoding each one joint angle; only works if parameter "deg_per_neuron" is not set
                 double deg_per_neuron   -- degree per neuron in the populations, encoding the joints angles; if set: population size depends on joint working range
                 string ini_path         -- Path to the "interface_param.ini"-file
+                string carrier          -- YARP carrier for the robot connections; empty: carrier option of the ini file
+                string coding           -- population coding of the joint angles: gaussian, von_mises or thermometer
 
         return: bool                    -- return True, if successful
     */
@@ -66,11 +153,15 @@ bool JointReader::Init(std::string part, double sigma, unsigned int pop_size, do
             std::cerr << "[Joint Reader " << icub_part << "] Population size have to be positive!" << std::endl;
             return false;
         }
-        if (sigma < 0) {
+        if (sigma <= 0) {
             std::cerr << "[Joint Reader " << icub_part << "] Sigma have to be positive!" << std::endl;
             return false;
         }
         sigma_pop = sigma;
+        if (!ParsePopCoding(coding, this->coding)) {
+            std::cerr << "[Joint Reader " << icub_part << "] " << coding << " is an invalid population coding! Valid codings: gaussian, von_mises, thermometer" << std::endl;
+            return false;
+        }
 
         // Check Yarp-network
         if (!yarp::os::Network::checkNetwork()) {
@@ -92,14 +183,21 @@ bool JointReader::Init(std::string part, double sigma, unsigned int pop_size, do
             std::cerr << "[Joint Reader " << icub_part << "] Error in parsing the ini-file! Please check the ini-path \"" << ini_path << "\" and the ini file content!" << std::endl;
             return false;
         }
-        std::string robot_port_prefix = reader_gen.Get("general", "robot_port_prefix", "/icubSim");
-        std::string client_port_prefix = reader_gen.Get("general", "client_port_prefix", "/client");
+        robot_port_prefix = reader_gen.Get("general", "robot_port_prefix", "/icubSim");
+        client_port_prefix = reader_gen.Get("general", "client_port_prefix", "/client");
+
+        // carrier of the control board connection and the state stream; [joint_reader] or [general] ini option, if the argument is empty
+        std::string port_carrier = carrier.empty() ? reader_gen.Get("joint_reader", "carrier", reader_gen.Get("general", "carrier", "")) : carrier;
+        this->carrier = port_carrier;
 
         // setup iCub joint control board
         yarp::os::Property options;
         options.put("device", "remote_controlboard");
         options.put("remote", (robot_port_prefix + "/" + icub_part).c_str());
         options.put("local", (client_port_prefix + "/ANNarchy_Jread_" + std::to_string(std::time(NULL)) + "/" + icub_part).c_str());
+        if (!port_carrier.empty()) {
+            options.put("carrier", port_carrier);
+        }
 
         if (!driver.open(options)) {
             std::cerr << "[Joint Reader " << icub_part << "] Unable to open " << options.find("device").asString() << "!" << std::endl;
@@ -113,6 +211,11 @@ bool JointReader::Init(std::string part, double sigma, unsigned int pop_size, do
             return false;
         }
 
+        // Open joint encoder interface with timestamps (optional) -> fallback: local time of the reading
+        if (!driver.view(ienc_timed)) {
+            ienc_timed = nullptr;
+        }
+
         // Open joint limits interface
         if (!driver.view(ilim)) {
             std::cerr << "[Joint Reader " << icub_part << "] Unable to open motor limit interface!" << std::endl;
@@ -122,6 +225,11 @@ bool JointReader::Init(std::string part, double sigma, unsigned int pop_size, do
 
         ienc->getAxes(&joints);
         joint_angles.resize(joints);
+        angles_buffer.resize(joints);
+        joint_stamps.resize(joints);
+        state_buffer.resize(3 * joints);
+        // sample layout of the sampling and streaming mode: angles, velocities, accelerations; allocated once, the readings may run on the gRPC thread
+        sample_lock.Resize(3 * joints);
         neuron_deg.resize(joints);
         joint_deg_res.resize(joints);
 
@@ -165,6 +273,14 @@ bool JointReader::Init(std::string part, double sigma, unsigned int pop_size, do
                 std::cerr << "[Joint Reader " << icub_part << "] Error in population size definition. Check the values for pop_size or deg_per_neuron!" << std::endl;
                 return false;
             }
+            max_neurons = std::max(max_neurons, static_cast<unsigned int>(neuron_deg[i].size()));
+        }
+        spike_rates.resize(max_neurons);
+        deadband.assign(joints, 0.);
+        pop_cache.clear();
+        ResetChanged();
+        if (this->coding == PopCoding::VON_MISES) {
+            InitVonMisesLUT();
         }
 
         // set parameter for save robot to file
@@ -176,6 +292,8 @@ bool JointReader::Init(std::string part, double sigma, unsigned int pop_size, do
             init_param["deg_per_neuron"] = std::to_string(deg_per_neuron);
         }
         init_param["ini_path"] = ini_path;
+        init_param["carrier"] = carrier;
+        init_param["coding"] = coding;
 
         this->dev_init = true;
         return true;
@@ -186,7 +304,8 @@ bool JointReader::Init(std::string part, double sigma, unsigned int pop_size, do
 }
 
 #ifdef _USE_GRPC
-bool JointReader::InitGRPC(std::string part, double sigma, unsigned int pop_size, double deg_per_neuron, std::string ini_path, std::string ip_address, unsigned int port) {
+bool JointReader::InitGRPC(std::string part, double sigma, unsigned int pop_size, double deg_per_neuron, std::string ini_path, std::string ip_address, unsigned int port, std::string carrier,
+                           std::string coding) {
     /*
         Initialize the joint reader with given parameters
 
@@ -197,12 +316,14 @@ bool JointReader::InitGRPC(std::string part, double sigma, unsigned int pop_size
                 ini_path                -- Path to the "interface_param.ini"-file
                 string ip_address       -- gRPC server ip address
                 unsigned int port       -- gRPC server port
+                string carrier          -- YARP carrier for the robot connections; empty: carrier option of the ini file
+                string coding           -- population coding of the joint angles: gaussian, von_mises or thermometer
 
         return: bool                    -- return True, if successful
     */
 
     if (!this->dev_init) {
-        if (this->Init(part, sigma, pop_size, deg_per_neuron, ini_path)) {
+        if (this->Init(part, sigma, pop_size, deg_per_neuron, ini_path, carrier, coding)) {
             this->_ip_address = ip_address;
             this->_port = port;
             this->joint_source = new ServerInstance(ip_address, port, this);
@@ -221,7 +342,8 @@ bool JointReader::InitGRPC(std::string part, double sigma, unsigned int pop_size
     }
 }
 #else
-bool JointReader::InitGRPC(std::string part, double sigma, unsigned int pop_size, double deg_per_neuron, std::string ini_path, std::string ip_address, unsigned int port) {
+bool JointReader::InitGRPC(std::string part, double sigma, unsigned int pop_size, double deg_per_neuron, std::string ini_path, std::string ip_address, unsigned int port, std::string carrier,
+                           std::string coding) {
     /*
         Initialize the joint reader with given parameters
 
@@ -232,6 +354,8 @@ bool JointReader::InitGRPC(std::string part, double sigma, unsigned int pop_size
                 string ini_path         -- Path to the "interface_param.ini"-file
                 string ip_address       -- gRPC server ip address
                 unsigned int port       -- gRPC server port
+                string carrier          -- YARP carrier for the robot connections; empty: carrier option of the ini file
+                string coding           -- population coding of the joint angles: gaussian, von_mises or thermometer
 
         return: bool                    -- return True, if successful
     */
@@ -244,6 +368,8 @@ void JointReader::Close() {
     /*
         Close joint reader with cleanup
     */
+    StopSampling();
+    StopStreaming();
     if (driver.isValid()) {
         driver.close();
     }
@@ -259,6 +385,237 @@ void JointReader::Close() {
     this->dev_init = false;
 }
 
+bool JointReader::SetSamplingMode(bool threaded, double rate) {
+    /*
+        Select the sampling mode: background sampling of the joint encoders or a robot request per reading
+
+        params: bool threaded           -- true: background sampling; false: every reading requests the joint angles from the robot
+                double rate             -- sampling rate in Hz of the background sampling
+
+        return: bool                    -- return True, if successful
+    */
+
+    if (!CheckInit()) {
+        return false;
+    }
+    if (threaded && rate <= 0.) {
+        std::cerr << "[Joint Reader " << icub_part << "] The sampling rate has to be positive!" << std::endl;
+        return false;
+    }
+
+    StopSampling();
+    StopStreaming();
+    if (threaded) {
+        sample_period = 1. / rate;
+        // first sample before the start -> the readings never find an empty or outdated sample
+        double time;
+        while (!ReadDeviceState(state_buffer.data(), joint_stamps.data(), time)) {
+            yarp::os::Time::delay(0.001);
+        }
+        sample_lock.Write(state_buffer.data(), time);
+        if (history.Length() > 0) {
+            history.Write(state_buffer.data(), time);
+        }
+        sampling = true;
+        sampler_thread = std::thread(&JointReader::SampleLoop, this);
+    }
+    return true;
+}
+
+bool JointReader::SetStreamingMode(bool streaming) {
+    /*
+        Select the streaming mode: receive the joint state stream of the control board or read the joints through the control board device
+
+        params: bool streaming          -- true: receive the joint state stream (stateExt:o); false: read through the control board device
+
+        return: bool                    -- return True, if successful
+    */
+
+    if (!CheckInit()) {
+        return false;
+    }
+
+    StopSampling();
+    StopStreaming();
+    if (streaming) {
+        std::string remote = robot_port_prefix + "/" + icub_part + "/stateExt:o";
+        std::string local = client_port_prefix + "/ANNarchy_Jread_" + std::to_string(std::time(NULL)) + "/" + icub_part + "/stateExt:i";
+
+        // number of the last sample, e.g. of a previous sampling mode
+        double time;
+        auto last_sample = sample_lock.Read(angles_buffer.data(), time, 0, joints);
+        if (!state_port.open(local)) {
+            std::cerr << "[Joint Reader " << icub_part << "] Unable to open the state port " << local << "!" << std::endl;
+            return false;
+        }
+        state_callback = std::make_unique<JointStateCallback>(state_port, sample_lock, joints);
+        state_port.useCallback(*state_callback);
+        if (!yarp::os::Network::connect(remote, local, carrier)) {
+            std::cerr << "[Joint Reader " << icub_part << "] Unable to connect to the state stream " << remote << "!" << std::endl;
+            state_port.close();
+            state_callback.reset();
+            return false;
+        }
+
+        // wait for the first state message -> the readings never find an empty or outdated sample
+        double timeout = yarp::os::Time::now() + 1.;
+        while (sample_lock.Read(angles_buffer.data(), time, 0, joints) == last_sample) {
+            if (yarp::os::Time::now() > timeout) {
+                std::cerr << "[Joint Reader " << icub_part << "] No joint state received from " << remote << "!" << std::endl;
+                yarp::os::Network::disconnect(remote, local);
+                state_port.close();
+                state_callback.reset();
+                return false;
+            }
+            yarp::os::Time::delay(0.001);
+        }
+        this->streaming = true;
+    }
+    return true;
+}
+
+bool JointReader::SetHistory(unsigned int length, double rate) {
+    /*
+        Keep the history of the joint angles in a ring buffer, filled by the sampler thread
+
+        params: unsigned int length     -- number of samples in the history; 0 -> no history
+                double rate             -- sampling rate in Hz of the history
+
+        return: bool                    -- return True, if successful
+    */
+
+    if (!CheckInit()) {
+        return false;
+    }
+    if (length > 0 && rate <= 0.) {
+        std::cerr << "[Joint Reader " << icub_part << "] The sampling rate has to be positive!" << std::endl;
+        return false;
+    }
+
+    // the ring is resized only while the sampler thread is stopped
+    bool resume = sampling;
+    StopSampling();
+    history.Resize(length, joints);
+    if (length > 0) {
+        return SetSamplingMode(true, rate);
+    }
+    if (resume) {
+        return SetSamplingMode(true, 1. / sample_period);
+    }
+    return true;
+}
+
+unsigned int JointReader::GetHistoryLength() {
+    /*
+        Return the number of samples in the history
+
+        return: unsigned int            -- number of samples; 0 if no history is recorded
+    */
+
+    return static_cast<unsigned int>(history.Length());
+}
+
+int JointReader::ReadHistoryLastInto(unsigned int n, double *buffer, double *timestamps, size_t size) {
+    /*
+        Copy the last n samples of the history into preallocated buffers, oldest sample first
+
+        params: unsigned int n          -- number of samples
+                double *buffer          -- output buffer for n x joints angles
+                double *timestamps      -- output buffer for n timestamps; nullptr -> no timestamps
+                size_t size             -- number of elements of the angle buffer
+
+        return: int                     -- number of copied samples; -1 at error
+    */
+
+    if (!CheckInit()) {
+        return -1;
+    }
+    if (n > history.Length()) {
+        std::cerr << "[Joint Reader " << icub_part << "] Requested " << n << " samples, the history holds " << history.Length() << " samples!" << std::endl;
+        return -1;
+    }
+    if (size < static_cast<size_t>(n) * joints) {
+        std::cerr << "[Joint Reader " << icub_part << "] Buffer size " << size << " is too small for " << n << " samples!" << std::endl;
+        return -1;
+    }
+
+    return static_cast<int>(history.ReadLast(buffer, timestamps, n));
+}
+
+int JointReader::ReadHistorySinceInto(double since, double *buffer, double *timestamps, size_t size) {
+    /*
+        Copy the samples of the history newer than the given time into preallocated buffers, oldest sample first
+
+        params: double since            -- time limit in seconds
+                double *buffer          -- output buffer for history length x joints angles
+                double *timestamps      -- output buffer for history length timestamps; nullptr -> no timestamps
+                size_t size             -- number of elements of the angle buffer
+
+        return: int                     -- number of copied samples; -1 at error
+    */
+
+    if (!CheckInit()) {
+        return -1;
+    }
+    if (history.Length() == 0) {
+        std::cerr << "[Joint Reader " << icub_part << "] No history is recorded!" << std::endl;
+        return -1;
+    }
+    if (size < history.Length() * joints) {
+        std::cerr << "[Joint Reader " << icub_part << "] Buffer size " << size << " is too small for " << history.Length() << " samples!" << std::endl;
+        return -1;
+    }
+
+    return static_cast<int>(history.ReadSince(buffer, timestamps, since));
+}
+
+bool JointReader::ReadStateAll(double *positions, double *velocities, double *accelerations, double *timestamp) {
+    /*
+        Read the joint state of all joints: joint angles, velocities and accelerations
+
+        params: double *positions       -- output array for the joint angles of all joints
+                double *velocities      -- output array for the joint velocities of all joints
+                double *accelerations   -- output array for the joint accelerations of all joints
+                double *timestamp       -- output for the timestamp of the state in seconds
+
+        return: bool                    -- return True, if successful
+    */
+
+    if (!CheckInit()) {
+        return false;
+    }
+
+    ReadState(state_buffer.data(), joint_stamps.data());
+    std::copy(state_buffer.begin(), state_buffer.begin() + joints, positions);
+    std::copy(state_buffer.begin() + joints, state_buffer.begin() + 2 * joints, velocities);
+    std::copy(state_buffer.begin() + 2 * joints, state_buffer.end(), accelerations);
+    *timestamp = *std::max_element(joint_stamps.begin(), joint_stamps.end());
+    return true;
+}
+
+bool JointReader::ReadStateAllInto(double *buffer, size_t size) {
+    /*
+        Read the joint state of all joints into one contiguous buffer: timestamps, joint angles, velocities and accelerations
+
+        params: double *buffer          -- output buffer for 4 x joints values
+                size_t size             -- number of elements of the buffer
+
+        return: bool                    -- return True, if successful
+    */
+
+    if (!CheckInit()) {
+        return false;
+    }
+    if (size != 4 * static_cast<size_t>(joints)) {
+        std::cerr << "[Joint Reader " << icub_part << "] Buffer size " << size << " does not match the state buffer size " << 4 * joints << "!" << std::endl;
+        return false;
+    }
+
+    // rows: timestamps | angles, velocities, accelerations
+    ReadState(buffer + joints, buffer);
+    return true;
+}
+
 int JointReader::GetJointCount() {
     /*
         Return number of controlled joints
@@ -298,6 +655,145 @@ std::vector<unsigned int> JointReader::GetNeuronsPerJoint() {
     return neuron_counts;
 }
 
+unsigned int JointReader::GetMaxNeuronsPerJoint() {
+    /*
+        Return the size of the largest population -> row length of the buffer of ReadPopAllInto
+
+        return: unsigned int        -- maximum number of neurons per joint
+    */
+
+    if (CheckInit())
+        return max_neurons;
+    else
+        return 0;
+}
+
+bool JointReader::SetSparseCutoff(double cutoff) {
+    /*
+        Restrict the population coding to the neurons within cutoff * sigma of the joint angle
+
+        params: double cutoff           -- half width of the encoding window in multiples of sigma; 0 -> default window
+
+        return: bool                    -- return True, if the cutoff is valid
+    */
+
+    if (cutoff < 0.) {
+        std::cerr << "[Joint Reader " << icub_part << "] The sparse cutoff has to be positive!" << std::endl;
+        return false;
+    }
+    if (coding != PopCoding::GAUSSIAN) {
+        std::cerr << "[Joint Reader " << icub_part << "] The sparse cutoff is only available for the Gaussian coding!" << std::endl;
+        return false;
+    }
+    // the lookup table is zero beyond lut_cutoff anyway
+    sparse_cutoff = std::min(cutoff, static_cast<double>(lut_cutoff));
+    // the cached populations were encoded with the previous window
+    if (this->dev_init) {
+        ResetChanged();
+    }
+    return true;
+}
+
+unsigned int JointReader::GetSparseWidth() {
+    /*
+        Return the maximum number of neurons within the encoding window -> row length of the value buffer of ReadPopAllSparseInto
+
+        return: unsigned int        -- maximum number of encoded neurons per joint
+    */
+
+    unsigned int width = 0;
+    if (CheckInit()) {
+        // the other codings evaluate the whole population
+        if (coding != PopCoding::GAUSSIAN) {
+            return max_neurons;
+        }
+        double cutoff = (sparse_cutoff > 0.) ? sparse_cutoff : lut_cutoff;
+        for (int i = 0; i < joints; i++) {
+            // +2: both window borders may fall on a neuron; +1: floating point rounding of the window borders
+            auto window = static_cast<unsigned int>(std::floor(2. * cutoff * sigma_pop / joint_deg_res[i])) + 3;
+            width = std::max(width, std::min(window, static_cast<unsigned int>(neuron_deg[i].size())));
+        }
+    }
+    return width;
+}
+
+bool JointReader::SetDeadband(std::vector<double> deadband, bool cache_pop) {
+    /*
+        Set the deadbands of the joints for the change detection
+
+        params: std::vector<double> deadband    -- deadband in degree; one value for all joints or one value per joint; empty -> no deadband
+                bool cache_pop                  -- reuse the cached population of unchanged joints
+
+        return: bool                            -- return True, if successful
+    */
+
+    if (!CheckInit()) {
+        return false;
+    }
+    if (deadband.size() > 1 && deadband.size() != static_cast<size_t>(joints)) {
+        std::cerr << "[Joint Reader " << icub_part << "] Number of deadbands " << deadband.size() << " does not match the joint count " << joints << "!" << std::endl;
+        return false;
+    }
+    for (auto band : deadband) {
+        if (!(band >= 0.)) {
+            std::cerr << "[Joint Reader " << icub_part << "] The deadbands have to be positive!" << std::endl;
+            return false;
+        }
+    }
+
+    if (deadband.empty()) {
+        this->deadband.assign(joints, 0.);
+    } else if (deadband.size() == 1) {
+        this->deadband.assign(joints, deadband[0]);
+    } else {
+        this->deadband = deadband;
+    }
+    if (cache_pop) {
+        pop_cache.assign(static_cast<size_t>(joints) * max_neurons, 0.);
+    } else {
+        pop_cache.clear();
+    }
+    ResetChanged();
+    return true;
+}
+
+std::vector<double> JointReader::GetDeadband() {
+    /*
+        Return the deadbands of the joints
+
+        return: std::vector<double>     -- deadband in degree per joint
+    */
+
+    CheckInit();
+    return deadband;
+}
+
+int JointReader::ReadChangedMaskInto(uint8_t *mask, size_t size) {
+    /*
+        Read all joints and write the changed mask since the last call into a preallocated buffer
+
+        params: uint8_t *mask           -- output buffer for one value per joint: 1 if the joint moved beyond its deadband, otherwise 0
+                size_t size             -- number of elements of the buffer
+
+        return: int                     -- number of changed joints; -1 at error
+    */
+
+    if (!CheckInit()) {
+        return -1;
+    }
+    if (size != static_cast<size_t>(joints)) {
+        std::cerr << "[Joint Reader " << icub_part << "] Buffer size " << size << " does not match the joint count " << joints << "!" << std::endl;
+        return -1;
+    }
+
+    std::vector<double> angles(joints);
+    ReadEncoders(angles.data());
+    std::lock_guard<std::mutex> lock(changed_mutex);
+    UpdateChanged(mask_changes, angles.data());
+    std::memcpy(mask, mask_changes.changed_mask.data(), joints * sizeof(uint8_t));
+    return std::count(mask_changes.changed_mask.begin(), mask_changes.changed_mask.end(), 1);
+}
+
 std::vector<double> JointReader::ReadDoubleAll() {
     /*
         Read all joints and return joint angles directly as double value
@@ -308,9 +804,7 @@ std::vector<double> JointReader::ReadDoubleAll() {
     std::vector<double> angles;
     if (CheckInit()) {
         angles.resize(joints);
-        while (!ienc->getEncoders(angles.data())) {
-            yarp::os::Time::delay(0.001);
-        }
+        ReadEncoders(angles.data());
     }
     return angles;
 }
@@ -325,15 +819,36 @@ std::vector<double> JointReader::ReadDoubleAllTime() {
 
     if (CheckInit()) {
         angles.resize(joints);
-        while (!ienc->getEncoders(angles.data())) {
-            yarp::os::Time::delay(0.001);
-        }
-        angle_stamped.push_back(yarp::os::Time::now() * 1000.);
+        double stamp;
+        ReadEncoders(angles.data(), &stamp);
+        angle_stamped.push_back(stamp * 1000.);
         angle_stamped.insert(angle_stamped.end(), angles.begin(), angles.end());
     }
     return angle_stamped;
 }
 
+bool JointReader::ReadDoubleAllInto(double *buffer, size_t size) {
+    /*
+        Read all joints and write the joint angles into a preallocated buffer
+
+        params: double *buffer          -- output buffer for the joint angles
+                size_t size             -- number of elements of the buffer
+
+        return: bool                    -- return True, if successful
+    */
+
+    if (!CheckInit()) {
+        return false;
+    }
+    if (size != static_cast<size_t>(joints)) {
+        std::cerr << "[Joint Reader " << icub_part << "] Buffer size " << size << " does not match the joint count " << joints << "!" << std::endl;
+        return false;
+    }
+
+    ReadEncoders(buffer);
+    return true;
+}
+
 std::vector<double> JointReader::ReadDoubleMultiple(std::vector<int> joint_select) {
     /*
         Read multiple joints and return joint angles directly as double value
@@ -349,9 +864,7 @@ std::vector<double> JointReader::ReadDoubleMultiple(std::vector<int> joint_selec
         const auto [min, max] = std::minmax_element(joint_select.begin(), joint_select.end());
         if (*min >= 0 && *max < joints) {
             angles.resize(joints);
-            while (!ienc->getEncoders(angles.data())) {
-                yarp::os::Time::delay(0.001);
-            }
+            ReadEncoders(angles.data());
             for (unsigned int i = 0; i < joint_select.size(); i++) {
                 angle_select.push_back(angles[joint_select[i]]);
             }
@@ -370,12 +883,11 @@ std::vector<double> JointReader::ReadDoubleMultipleTime(std::vector<int> joint_s
 
     if (CheckInit()) {
         const auto [min, max] = std::minmax_element(joint_select.begin(), joint_select.end());
-        if (*min > 0 && *max < joints) {
+        if (*min >= 0 && *max < joints) {
             angles.resize(joints);
-            while (!ienc->getEncoders(angles.data())) {
-                yarp::os::Time::delay(0.001);
-            }
-            angle_stamped.push_back(yarp::os::Time::now() * 1000.);
+            double stamp;
+            ReadEncoders(angles.data(), &stamp);
+            angle_stamped.push_back(stamp * 1000.);
             for (unsigned int i = 0; i < joint_select.size(); i++) {
                 angle_select.push_back(angles[joint_select[i]]);
             }
@@ -397,9 +909,7 @@ double JointReader::ReadDoubleOne(int joint) {
     double angle = -999.;
     if (CheckInit()) {
         if (joint < joints && joint >= 0) {
-            while (!ienc->getEncoder(joint, &angle)) {
-                yarp::os::Time::delay(0.001);
-            }
+            angle = ReadEncoder(joint);
         } else {
             std::cerr << "[Joint Reader " << icub_part << "] Selected joint <" << joint << "> is out of range!" << std::endl;
         }
@@ -421,10 +931,9 @@ std::vector<double> JointReader::ReadDoubleOneTime(int joint) {
 
     if (CheckInit()) {
         if (joint < joints && joint >= 0) {
-            while (!ienc->getEncoder(joint, &angle)) {
-                yarp::os::Time::delay(0.001);
-            }
-            angle_stamped.push_back(yarp::os::Time::now() * 1000.);
+            double stamp;
+            angle = ReadEncoder(joint, &stamp);
+            angle_stamped.push_back(stamp * 1000.);
             angle_stamped.push_back(angle);
         } else {
             std::cerr << "[Joint Reader " << icub_part << "] Selected joint <" << joint << "> is out of range!" << std::endl;
@@ -443,18 +952,133 @@ std::vector<std::vector<double>> JointReader::ReadPopAll() {
     auto angle_pops = std::vector<std::vector<double>>(joints, std::vector<double>());
 
     if (CheckInit()) {
-        std::vector<double> angles;
-        angles.resize(joints);
-        while (!ienc->getEncoders(angles.data())) {
-            yarp::os::Time::delay(0.01);
-        }
+        std::lock_guard<std::mutex> lock(buffer_mutex);
+        ReadEncodersChanged();
         for (int i = 0; i < joints; i++) {
-            angle_pops[i] = Encode(angles[i], i);
+            angle_pops[i].resize(neuron_deg[i].size());
+            EncodeBuffered(i, angle_pops[i].data());
         }
     }
     return angle_pops;
 }
 
+bool JointReader::ReadPopAllInto(double *buffer, size_t size, unsigned int row_size) {
+    /*
+        Read all joints and write the joint angles encoded in populations into a preallocated buffer
+
+        params: double *buffer          -- output buffer for joints x row_size values; rows of smaller populations are zero padded
+                size_t size             -- number of elements of the buffer
+                unsigned int row_size   -- number of values per joint row; 0 -> max_neurons
+
+        return: bool                    -- return True, if successful
+    */
+
+    if (!CheckInit()) {
+        return false;
+    }
+    if (row_size == 0) {
+        row_size = max_neurons;
+    }
+    if (row_size < max_neurons) {
+        std::cerr << "[Joint Reader " << icub_part << "] Row size " << row_size << " is smaller than the largest population " << max_neurons << "!" << std::endl;
+        return false;
+    }
+    if (size != static_cast<size_t>(joints) * row_size) {
+        std::cerr << "[Joint Reader " << icub_part << "] Buffer size " << size << " does not match the population buffer size " << static_cast<size_t>(joints) * row_size << "!" << std::endl;
+        return false;
+    }
+
+    std::lock_guard<std::mutex> lock(buffer_mutex);
+    ReadEncodersChanged();
+    for (int i = 0; i < joints; i++) {
+        double *row = buffer + static_cast<size_t>(i) * row_size;
+        auto n = neuron_deg[i].size();
+        EncodeBuffered(i, row);
+        std::memset(row + n, 0, (row_size - n) * sizeof(double));
+    }
+    return true;
+}
+
+bool JointReader::ReadPopAllSparseInto(int *start, int *count, double *values, size_t size) {
+    /*
+        Read all joints and write the sparse population code into preallocated buffers
+
+        params: int *start              -- index of the first encoded neuron per joint
+                int *count              -- number of encoded neurons per joint
+                double *values          -- output buffer for joints x sparse width values
+                size_t size             -- number of elements of the value buffer
+
+        return: bool                    -- return True, if successful
+    */
+
+    if (!CheckInit()) {
+        return false;
+    }
+    int width = GetSparseWidth();
+    if (size != static_cast<size_t>(joints) * width) {
+        std::cerr << "[Joint Reader " << icub_part << "] Buffer size " << size << " does not match the sparse buffer size " << static_cast<size_t>(joints) * width << "!" << std::endl;
+        return false;
+    }
+
+    std::lock_guard<std::mutex> lock(buffer_mutex);
+    ReadEncodersChanged();
+    for (int i = 0; i < joints; i++) {
+        int first, last;
+        EncodeWindow(angles_buffer[i], i, first, last);
+        if (last - first > width) {
+            std::cerr << "[Joint Reader " << icub_part << "] Encoding window of joint " << i << " exceeds the sparse width " << width << "!" << std::endl;
+            return false;
+        }
+        EncodeBuffered(i, first, last, values + static_cast<size_t>(i) * width);
+        start[i] = first;
+        count[i] = last - first;
+    }
+    return true;
+}
+
+int JointReader::ReadPopAllSpikesInto(int *indices, size_t size, double max_rate, double dt) {
+    /*
+        Read all joints and draw one time step of Poisson spike trains from the population code
+
+        params: int *indices            -- output buffer for the indices of the spiking neurons in the (joints x max_neurons) population array
+                size_t size             -- number of elements of the index buffer
+                double max_rate         -- firing rate in Hz for the population code value 1
+                double dt               -- length of the time step in seconds
+
+        return: int                     -- number of spiking neurons; -1 at error
+    */
+
+    if (!CheckInit()) {
+        return -1;
+    }
+    if (max_rate < 0. || dt <= 0.) {
+        std::cerr << "[Joint Reader " << icub_part << "] The firing rate has to be positive and the time step larger than zero!" << std::endl;
+        return -1;
+    }
+    if (size < static_cast<size_t>(joints) * max_neurons) {
+        std::cerr << "[Joint Reader " << icub_part << "] Buffer size " << size << " is smaller than the population buffer size " << static_cast<size_t>(joints) * max_neurons << "!" << std::endl;
+        return -1;
+    }
+
+    const double p_max = max_rate * dt;    // spike probability for the code value 1
+    int n_spikes = 0;
+    std::lock_guard<std::mutex> lock(buffer_mutex);
+    ReadEncodersChanged();
+    for (int i = 0; i < joints; i++) {
+        // only the neurons within the encoding window can spike
+        int first, last;
+        EncodeWindow(angles_buffer[i], i, first, last);
+        EncodeBuffered(i, first, last, spike_rates.data());
+        int offset = i * static_cast<int>(max_neurons) + first;
+        for (int j = 0; j < last - first; j++) {
+            if (UniformRandom() < spike_rates[j] * p_max) {
+                indices[n_spikes++] = offset + j;
+            }
+        }
+    }
+    return n_spikes;
+}
+
 std::vector<std::vector<double>> JointReader::ReadPopMultiple(std::vector<int> joint_select) {
     /*
         Read multiple joints and return joint angles encoded in vectors
@@ -471,9 +1095,7 @@ std::vector<std::vector<double>> JointReader::ReadPopMultiple(std::vector<int> j
         const auto [min, max] = std::minmax_element(joint_select.begin(), joint_select.end());
         if (*min >= 0 && *max < joints) {
             angles.resize(joints);
-            while (!ienc->getEncoders(angles.data())) {
-                yarp::os::Time::delay(0.001);
-            }
+            ReadEncoders(angles.data());
             for (unsigned int i = 0; i < joint_select.size(); i++) {
                 angle_select.push_back(Encode(angles[joint_select[i]], joint_select[i]));
             }
@@ -494,10 +1116,7 @@ std::vector<double> JointReader::ReadPopOne(int joint) {
     std::vector<double> angle_pop;
     if (CheckInit()) {
         if (joint < joints && joint >= 0) {
-            double angle;
-            while (!ienc->getEncoder(joint, &angle)) {
-                yarp::os::Time::delay(0.01);
-            }
+            double angle = ReadEncoder(joint);
             angle_pop = Encode(angle, joint);
         } else {
             std::cerr << "[Joint Reader " << icub_part << "] Selected joint <" << joint << "> is out of range!" << std::endl;
@@ -531,19 +1150,365 @@ std::vector<double> JointReader::provideData(std::vector<int> value, bool enc) {
 
 std::vector<double> JointReader::provideData(bool enc) {
     if (enc) {
-        auto angles = ReadPopAll();
+        // encode the populations directly into the concatenated message vector
         std::vector<double> v;
-        for (size_t i = 0; i < angles.size(); i++) {
-            v.insert(v.end(), angles[i].begin(), angles[i].end());
+        if (CheckInit()) {
+            size_t total = 0;
+            for (int i = 0; i < joints; i++) {
+                total += neuron_deg[i].size();
+            }
+            v.resize(total);
+            std::lock_guard<std::mutex> lock(buffer_mutex);
+            ReadEncodersChanged();
+            size_t offset = 0;
+            for (int i = 0; i < joints; i++) {
+                EncodeBuffered(i, v.data() + offset);
+                offset += neuron_deg[i].size();
+            }
         }
         return v;
     } else {
         return ReadDoubleAll();
     }
 }
+
+std::vector<double> JointReader::provideSparseData(std::vector<int> &start, std::vector<int> &count) {
+    // sparse population code of all joints; start indices refer to the concatenated populations
+    std::vector<double> v;
+    start.clear();
+    count.clear();
+    if (CheckInit()) {
+        std::lock_guard<std::mutex> lock(buffer_mutex);
+        ReadEncodersChanged();
+        int offset = 0;
+        for (int i = 0; i < joints; i++) {
+            int first, last;
+            EncodeWindow(angles_buffer[i], i, first, last);
+            auto pos = v.size();
+            v.resize(pos + last - first);
+            EncodeBuffered(i, first, last, v.data() + pos);
+            start.push_back(offset + first);
+            count.push_back(last - first);
+            offset += neuron_deg[i].size();
+        }
+    }
+    return v;
+}
+
+std::vector<double> JointReader::provideChangedData(uint64_t consumer, bool enc, bool sparse, bool resync, std::vector<int> &joint,
+                                                    std::vector<int> &start, std::vector<int> &count) {
+    // joints changed beyond their deadband since the last readout of this consumer; start indices refer to the joint angles or to the concatenated populations
+    std::vector<double> v;
+    joint.clear();
+    start.clear();
+    count.clear();
+    if (CheckInit()) {
+        std::vector<double> angles(joints);
+        ReadEncoders(angles.data());
+        std::lock_guard<std::mutex> lock(changed_mutex);
+        // remove the consumers, which stopped polling (e.g. closed clients); a resync starts with a new entry
+        auto now = std::chrono::steady_clock::now();
+        for (auto it = grpc_changes.begin(); it != grpc_changes.end();) {
+            if (it->first == consumer ? resync : std::chrono::duration<double>(now - it->second.last_poll).count() > changed_timeout) {
+                it = grpc_changes.erase(it);
+            } else {
+                ++it;
+            }
+        }
+        auto &changes = grpc_changes[consumer];
+        if (changes.reported_angles.empty()) {
+            ResetChanged(changes);
+        }
+        changes.last_poll = now;
+        UpdateChanged(changes, angles.data());
+        int offset = 0;
+        for (int i = 0; i < joints; i++) {
+            int size = neuron_deg[i].size();
+            if (changes.changed_mask[i]) {
+                joint.push_back(i);
+                if (!enc) {
+                    v.push_back(angles[i]);
+                    start.push_back(i);
+                    count.push_back(1);
+                } else {
+                    int first = 0, last = size;
+                    if (sparse) {
+                        EncodeWindow(angles[i], i, first, last);
+                    }
+                    auto pos = v.size();
+                    v.resize(pos + last - first);
+                    EncodeRange(angles[i], i, first, last, v.data() + pos);
+                    start.push_back(offset + first);
+                    count.push_back(last - first);
+                }
+            }
+            offset += size;
+        }
+    }
+    return v;
+}
 #endif
 
 /*** auxilary functions ***/
+void JointReader::SampleLoop() {
+    /*
+        Poll the joint encoders with the sampling period and publish the samples; after an overrun the next sample is taken at once, without catching up
+    */
+
+    std::vector<double> sample(3 * joints);
+    std::vector<double> stamps(joints);
+    auto period = std::chrono::duration_cast<std::chrono::steady_clock::duration>(std::chrono::duration<double>(sample_period));
+    auto next = std::chrono::steady_clock::now();
+
+    while (sampling) {
+        double time;
+        if (ReadDeviceState(sample.data(), stamps.data(), time)) {
+            sample_lock.Write(sample.data(), time);
+            if (history.Length() > 0) {
+                history.Write(sample.data(), time);
+            }
+        }
+        next += period;
+        auto now = std::chrono::steady_clock::now();
+        if (next < now) {
+            next = now;
+        }
+        std::this_thread::sleep_until(next);
+    }
+}
+
+void JointReader::StopSampling() {
+    /*
+        Stop the sampler thread
+    */
+
+    if (sampling) {
+        sampling = false;
+        if (sampler_thread.joinable()) {
+            sampler_thread.join();
+        }
+    }
+}
+
+void JointReader::StopStreaming() {
+    /*
+        Disconnect and close the state stream
+    */
+
+    if (streaming) {
+        streaming = false;
+        yarp::os::Network::disconnect(robot_port_prefix + "/" + icub_part + "/stateExt:o", state_port.getName());
+        state_port.interrupt();
+        state_port.close();
+        state_callback.reset();
+    }
+}
+
+void JointReader::ReadEncoders(double *angles, double *timestamp) {
+    /*
+        Read all joint angles: newest sample in the sampling or streaming mode, otherwise requested from the robot
+
+        params: double *angles          -- output array for the joint angles of all joints
+                double *timestamp       -- optional output for the time of the reading in seconds
+    */
+
+    double time;
+    if (sampling || streaming) {
+        // the joint angles are the first values of the sample in both modes
+        sample_lock.Read(angles, time, 0, joints);
+    } else if (timestamp != nullptr && ienc_timed != nullptr) {
+        // robot-side timestamps of the joints -> newest one
+        while (!ienc_timed->getEncodersTimed(angles, joint_stamps.data())) {
+            yarp::os::Time::delay(0.001);
+        }
+        time = *std::max_element(joint_stamps.begin(), joint_stamps.end());
+    } else {
+        while (!ienc->getEncoders(angles)) {
+            yarp::os::Time::delay(0.001);
+        }
+        time = yarp::os::Time::now();
+    }
+    if (timestamp != nullptr) {
+        *timestamp = time;
+    }
+}
+
+double JointReader::ReadEncoder(int joint, double *timestamp) {
+    /*
+        Read one joint angle: newest sample in the sampling or streaming mode, otherwise requested from the robot
+
+        params: int joint               -- joint number of the robot part
+                double *timestamp       -- optional output for the time of the reading in seconds
+
+        return: double                  -- joint angle
+    */
+
+    double angle;
+    if (sampling || streaming) {
+        // the joint angles are the first values of the sample in both modes
+        double time;
+        sample_lock.Read(&angle, time, joint, 1);
+        if (timestamp != nullptr) {
+            *timestamp = time;
+        }
+    } else if (timestamp != nullptr && ienc_timed != nullptr) {
+        while (!ienc_timed->getEncoderTimed(joint, &angle, timestamp)) {
+            yarp::os::Time::delay(0.001);
+        }
+    } else {
+        while (!ienc->getEncoder(joint, &angle)) {
+            yarp::os::Time::delay(0.001);
+        }
+        if (timestamp != nullptr) {
+            *timestamp = yarp::os::Time::now();
+        }
+    }
+    return angle;
+}
+
+bool JointReader::ReadDeviceState(double *state, double *stamps, double &time) {
+    /*
+        Read the joint state from the control board device with one attempt; velocities and accelerations, which are not provided, are set to zero
+
+        params: double *state           -- output array for 3 x joints values: angles, velocities, accelerations
+                double *stamps          -- output array for the robot-side timestamps of the joints
+                double &time            -- newest timestamp of the joints
+
+        return: bool                    -- return True, if the joint angles were read
+    */
+
+    if (ienc_timed != nullptr) {
+        if (!ienc_timed->getEncodersTimed(state, stamps)) {
+            return false;
+        }
+        time = *std::max_element(stamps, stamps + joints);
+    } else {
+        if (!ienc->getEncoders(state)) {
+            return false;
+        }
+        time = yarp::os::Time::now();
+        std::fill(stamps, stamps + joints, time);
+    }
+    if (!ienc->getEncoderSpeeds(state + joints)) {
+        std::fill(state + joints, state + 2 * joints, 0.);
+    }
+    if (!ienc->getEncoderAccelerations(state + 2 * joints)) {
+        std::fill(state + 2 * joints, state + 3 * joints, 0.);
+    }
+    return true;
+}
+
+void JointReader::ReadState(double *state, double *stamps) {
+    /*
+        Read the joint state: newest sample in the sampling or streaming mode, otherwise requested from the robot
+
+        params: double *state           -- output array for 3 x joints values: angles, velocities, accelerations
+                double *stamps          -- output array for the timestamps of the joints
+    */
+
+    double time;
+    if (sampling || streaming) {
+        sample_lock.Read(state, time);
+        std::fill(stamps, stamps + joints, time);
+    } else {
+        while (!ReadDeviceState(state, stamps, time)) {
+            yarp::os::Time::delay(0.001);
+        }
+    }
+}
+
+void JointReader::UpdateChanged(ChangeState &changes, const double *angles) {
+    /*
+        Compare the joint angles of a reading of all joints with the reported angles of a consumer; the changed joints are reported with the new angle
+
+        params: ChangeState changes     -- change state of the consumer
+                double *angles          -- joint angles of all joints
+    */
+
+    for (int i = 0; i < joints; i++) {
+        // NaN -> not reported yet
+        bool moved = !(std::abs(angles[i] - changes.reported_angles[i]) <= deadband[i]);
+        changes.changed_mask[i] = moved;
+        if (moved) {
+            changes.reported_angles[i] = angles[i];
+        }
+    }
+}
+
+void JointReader::ResetChanged(ChangeState &changes) {
+    /*
+        Reset the change state of a consumer -> every joint counts as changed at its next update
+
+        params: ChangeState changes     -- change state of the consumer
+    */
+
+    changes.reported_angles.assign(joints, std::numeric_limits<double>::quiet_NaN());
+    changes.changed_mask.assign(joints, 1);
+}
+
+void JointReader::ResetChanged() {
+    /*
+        Reset the change detection of all consumers -> every joint counts as changed at the next update of each consumer
+    */
+
+    std::lock_guard<std::mutex> lock(changed_mutex);
+    ResetChanged(mask_changes);
+    ResetChanged(cache_changes);
+    grpc_changes.clear();
+}
+
+void JointReader::ReadEncodersChanged() {
+    /*
+        Read all joint angles into angles_buffer for the population readings; with the population cache, the joints within their
+        deadband keep the held angle -> matches the cached population. The consumers of the change detection are not affected.
+        The caller holds buffer_mutex until the encoding from angles_buffer is done.
+    */
+
+    ReadEncoders(angles_buffer.data());
+    if (!pop_cache.empty()) {
+        std::lock_guard<std::mutex> lock(changed_mutex);
+        UpdateChanged(cache_changes, angles_buffer.data());
+        for (int i = 0; i < joints; i++) {
+            if (cache_changes.changed_mask[i]) {
+                Encode(angles_buffer[i], i, pop_cache.data() + static_cast<size_t>(i) * max_neurons);
+            }
+        }
+        std::copy(cache_changes.reported_angles.begin(), cache_changes.reported_angles.end(), angles_buffer.begin());
+    }
+}
+
+void JointReader::EncodeBuffered(int joint, double *out) {
+    /*
+        Encode the joint population for the angle in angles_buffer; copied from the population cache if enabled
+
+        params: int joint                       -- joint number of the robot part
+                double *out                     -- output array with the size of the joint population
+    */
+
+    if (pop_cache.empty()) {
+        Encode(angles_buffer[joint], joint, out);
+    } else {
+        std::memcpy(out, pop_cache.data() + static_cast<size_t>(joint) * max_neurons, neuron_deg[joint].size() * sizeof(double));
+    }
+}
+
+void JointReader::EncodeBuffered(int joint, int first, int last, double *out) {
+    /*
+        Encode the neurons [first, last) of the joint population for the angle in angles_buffer; copied from the population cache if enabled
+
+        params: int joint                       -- joint number of the robot part
+                int first                       -- index of the first encoded neuron
+                int last                        -- index behind the last encoded neuron
+                double *out                     -- output array for last - first values
+    */
+
+    if (pop_cache.empty()) {
+        EncodeRange(angles_buffer[joint], joint, first, last, out);
+    } else {
+        std::memcpy(out, pop_cache.data() + static_cast<size_t>(joint) * max_neurons + first, (last - first) * sizeof(double));
+    }
+}
+
 bool JointReader::CheckPartKey(std::string key) {
     /*
         Check if iCub part key is valid
@@ -568,29 +1533,200 @@ std::vector<double> JointReader::Encode(double joint_angle, int joint) {
         return: std::vector<double>             -- population encoded joint angle
     */
 
-    auto size = neuron_deg.at(joint).size();
-    std::vector<double> pos_pop(size);
-    for (unsigned int i = 0; i < size; i++) {
-        pos_pop[i] = (NormalPdf(neuron_deg[joint][i], joint_angle, sigma_pop));
+    std::vector<double> pos_pop(neuron_deg.at(joint).size());
+    Encode(joint_angle, joint, pos_pop.data());
+    return pos_pop;
+}
+
+void JointReader::Encode(double joint_angle, int joint, double *out) {
+    /*
+        Encode given joint position into the output array; only the neurons within the encoding window are evaluated, the others are set to zero
+
+        params: double joint_angle              -- joint angle read from the robot
+                int joint                       -- joint number of the robot part
+                double *out                     -- output array with the size of the joint population
+    */
+
+    int size = neuron_deg[joint].size();
+    int first, last;
+    EncodeWindow(joint_angle, joint, first, last);
+    std::fill(out, out + first, 0.);
+    EncodeRange(joint_angle, joint, first, last, out + first);
+    std::fill(out + last, out + size, 0.);
+}
+
+template <bool circular>
+static void InterpolateLUT(const double *__restrict lut, const double *__restrict deg, double *__restrict pop, int size, double joint_angle, double scale, double x_max) {
+    /*
+        Linear interpolation of an envelope lookup table over the distance of the preferred angles to the joint angle; the loop is free of branches
+        and transcendental calls -> vectorized by the compiler (gather of the table values); the restrict qualified parameters rule out aliasing
+
+        params: double *lut                     -- lookup table over the distance
+                double *deg                     -- preferred angles of the neurons
+                double *pop                     -- output array for size values
+                int size                        -- number of neurons
+                double joint_angle              -- joint angle read from the robot
+                double scale                    -- table index per degree
+                double x_max                    -- last interpolation node
+                bool circular                   -- true: angular distance, wrapped into [0, 180] degree
+    */
+
+    for (int i = 0; i < size; i++) {
+        double d = std::abs(deg[i] - joint_angle);
+        if constexpr (circular) {
+            // d >= 0 -> truncation instead of floor (vectorized without fast-math)
+            d -= 360. * static_cast<int>(d * (1. / 360.));
+            d = d > 180. ? 360. - d : d;
+        }
+        double x = d * scale;
+        x = x < x_max ? x : x_max;
+        int idx = static_cast<int>(x);
+        double frac = x - idx;
+        pop[i] = lut[idx] + frac * (lut[idx + 1] - lut[idx]);
     }
+}
 
-    return pos_pop;
+template <>
+void JointReader::EncodeRangeImpl<PopCoding::GAUSSIAN>(double joint_angle, int joint, int first, int last, double *out) {
+    /*
+        Gaussian coding: the envelope is linearly interpolated from the shared lookup table (max. error ~2e-6)
+
+        params: double joint_angle              -- joint angle read from the robot
+                int joint                       -- joint number of the robot part
+                int first                       -- first neuron of the range
+                int last                        -- end of the neuron range (exclusive)
+                double *out                     -- output array for last - first values
+    */
+
+    const auto &table = GaussianLUT();
+    InterpolateLUT<false>(table.data(), neuron_deg[joint].data() + first, out, last - first, joint_angle, lut_res / sigma_pop, table.size() - 2);
+}
+
+template <>
+void JointReader::EncodeRangeImpl<PopCoding::VON_MISES>(double joint_angle, int joint, int first, int last, double *out) {
+    /*
+        von Mises coding: the angular distance is wrapped into [0, 180] degree, the envelope is linearly interpolated from the lookup table of the reader
+
+        params: double joint_angle              -- joint angle read from the robot
+                int joint                       -- joint number of the robot part
+                int first                       -- first neuron of the range
+                int last                        -- end of the neuron range (exclusive)
+                double *out                     -- output array for last - first values
+    */
+
+    InterpolateLUT<true>(von_mises_lut.data(), neuron_deg[joint].data() + first, out, last - first, joint_angle, lut_res / sigma_pop, von_mises_lut.size() - 2);
+}
+
+template <>
+void JointReader::EncodeRangeImpl<PopCoding::THERMOMETER>(double joint_angle, int joint, int first, int last, double *out) {
+    /*
+        Thermometer coding: all neurons with a preferred angle up to the joint angle are active
+
+        params: double joint_angle              -- joint angle read from the robot
+                int joint                       -- joint number of the robot part
+                int first                       -- first neuron of the range
+                int last                        -- end of the neuron range (exclusive)
+                double *out                     -- output array for last - first values
+    */
+
+    const double *__restrict deg = neuron_deg[joint].data() + first;
+    double *__restrict pop = out;
+    const int size = last - first;
+
+    for (int i = 0; i < size; i++) {
+        pop[i] = deg[i] <= joint_angle ? 1. : 0.;
+    }
 }
 
-double JointReader::NormalPdf(double value, double mean, double sigma) {
+void JointReader::EncodeRange(double joint_angle, int joint, int first, int last, double *out) {
     /*
-        Return the normal distribution value for a given value, mean and sigma
+        Encode given joint position for the neurons [first, last) with the population coding of the reader; the coding is selected once per joint,
+        the neuron loops are specialized per coding
+
+        params: double joint_angle              -- joint angle read from the robot
+                int joint                       -- joint number of the robot part
+                int first                       -- first neuron of the range
+                int last                        -- end of the neuron range (exclusive)
+                double *out                     -- output array for last - first values
+    */
+
+    switch (coding) {
+        case PopCoding::GAUSSIAN:
+            EncodeRangeImpl<PopCoding::GAUSSIAN>(joint_angle, joint, first, last, out);
+            break;
+        case PopCoding::VON_MISES:
+            EncodeRangeImpl<PopCoding::VON_MISES>(joint_angle, joint, first, last, out);
+            break;
+        case PopCoding::THERMOMETER:
+            EncodeRangeImpl<PopCoding::THERMOMETER>(joint_angle, joint, first, last, out);
+            break;
+    }
+}
 
-        params: double value            -- value to calculate normal distribution at
-                double mean             -- mean of the normal distribution
-                double sigma            -- sigma of the normal distribution
+void JointReader::EncodeWindow(double joint_angle, int joint, int &first, int &last) {
+    /*
+        Return the neuron index range within the encoding window (sparse cutoff or lookup table range) of the joint angle;
+        the neurons are equally spaced, starting at the lower joint limit
 
-        return: double                  -- function value for the normal distribution
+        params: double joint_angle              -- joint angle read from the robot
+                int joint                       -- joint number of the robot part
+                int &first                      -- first neuron within the window
+                int &last                       -- end of the window (exclusive)
     */
 
-    // double inv_sqrt_2pi = 4.0 / (sigma * std::sqrt(2 * M_PI));
-    double a = (value - mean) / sigma;
+    double size = neuron_deg[joint].size();
+    if (size == 0) {
+        first = last = 0;
+        return;
+    }
+    // circular and thermometer coding -> whole population
+    if (coding != PopCoding::GAUSSIAN) {
+        first = 0;
+        last = static_cast<int>(size);
+        return;
+    }
+    double half = ((sparse_cutoff > 0.) ? sparse_cutoff : lut_cutoff) * sigma_pop;
+    double lower = std::ceil((joint_angle - half - neuron_deg[joint][0]) / joint_deg_res[joint]);
+    double upper = std::floor((joint_angle + half - neuron_deg[joint][0]) / joint_deg_res[joint]) + 1.;
+    // clamp in floating point -> no integer overflow for angles far outside the joint range
+    first = static_cast<int>(std::min(std::max(lower, 0.), size));
+    last = static_cast<int>(std::min(std::max(upper, static_cast<double>(first)), size));
+}
+
+const std::vector<double> &JointReader::GaussianLUT() {
+    /*
+        Return the Gaussian lookup table exp(-0.5 x^2), shared by all joint readers; the last two entries are zero
 
-    // return inv_sqrt_2pi * std::exp(-0.5 * a * a);
-    return 1.0 * std::exp(-0.5 * a * a);
+        return: std::vector<double>     -- lookup table for x in [0, lut_cutoff] with lut_res entries per unit
+    */
+
+    static const std::vector<double> lut = []() {
+        std::vector<double> table(lut_res * lut_cutoff + 2, 0.);
+        for (int i = 0; i < lut_res * lut_cutoff; i++) {
+            double x = static_cast<double>(i) / lut_res;
+            table[i] = std::exp(-0.5 * x * x);
+        }
+        return table;
+    }();
+    return lut;
+}
+
+void JointReader::InitVonMisesLUT() {
+    /*
+        Compute the von Mises lookup table exp(kappa (cos(d) - 1)) over the angular distance d in degree with kappa = 1 / sigma^2 (sigma in radian);
+        the table covers [0, 180] degree, but at most lut_cutoff sigma, beyond the envelope is set to zero
+    */
+
+    const double scale = lut_res / sigma_pop;    // table entries per degree
+    const double range = std::min(180., lut_cutoff * sigma_pop);
+    const double sigma_rad = sigma_pop * M_PI / 180.;
+    const double kappa = 1. / (sigma_rad * sigma_rad);
+
+    von_mises_lut.assign(static_cast<size_t>(std::ceil(range * scale)) + 2, 0.);
+    for (size_t i = 0; i < von_mises_lut.size(); i++) {
+        double d = i / scale;
+        if (d <= lut_cutoff * sigma_pop) {
+            von_mises_lut[i] = std::exp(kappa * (std::cos(d * M_PI / 180.) - 1.));
+        }
+    }
 }
@@ -27,6 +27,7 @@
 #include <cmath>
 #include <ctime>
 #include <iostream>
+#include <limits>
 #include <sstream>
 #include <string>
 
@@ -40,7 +41,7 @@
 JointWriter::~JointWriter() { Close(); }
 
 /*** public methods for the user ***/
-bool JointWriter::Init(std::string part, unsigned int pop_size, double deg_per_neuron, double speed, std::string ini_path) {
+bool JointWriter::Init(std::string part, unsigned int pop_size, double deg_per_neuron, double speed, std::string ini_path, std::string carrier) {
     /*
         Initialize the joint writer with given parameters
 
@@ -49,6 +50,7 @@ bool JointWriter::Init(std::string part, unsigned int pop_size, double deg_per_n
                 double deg_per_neuron   -- degree per neuron in the populations, encoding the joints angles; if set: population size depends on joint working range
                 double speed            -- velocity for the joint motions
                 ini_path                -- Path to the "interface_param.ini"-file
+                string carrier          -- YARP carrier for the robot connections; empty: carrier option of the ini file
 
         return: bool                    -- return True, if successful
     */
@@ -94,11 +96,17 @@ bool JointWriter::Init(std::string part, unsigned int pop_size, double deg_per_n
         }
         std::string client_port_prefix = reader_gen.Get("general", "client_port_prefix", "/client");
 
+        // carrier of the control board connection; [joint_writer] or [general] ini option, if the argument is empty
+        std::string port_carrier = carrier.empty() ? reader_gen.Get("joint_writer", "carrier", reader_gen.Get("general", "carrier", "")) : carrier;
+
         // setup iCub joint position and velocity control
         yarp::os::Property options;
         options.put("device", "remote_controlboard");
         options.put("remote", (port_prefix + "/" + icub_part).c_str());
         options.put("local", (client_port_prefix + "/ANNarchy_write_" + std::to_string(std::time(NULL)) + "/" + icub_part).c_str());
+        if (!port_carrier.empty()) {
+            options.put("carrier", port_carrier);
+        }
 
         if (!driver.open(options)) {
             std::cerr << "[Joint Writer " << icub_part << "] Unable to open" << options.find("device").asString() << "!" << std::endl;
@@ -200,12 +208,26 @@ bool JointWriter::Init(std::string part, unsigned int pop_size, double deg_per_n
             }
         }
 
+        // contiguous degree tables for the decoding, rows padded to the largest population
+        decode_stride = 0;
+        for (int i = 0; i < joints; i++) {
+            decode_stride = std::max({decode_stride, neuron_deg_abs[i].size(), neuron_deg_rel[i].size()});
+        }
+        decode_deg_abs.assign(joints * decode_stride, 0.);
+        decode_deg_rel.assign(joints * decode_stride, 0.);
+        for (int i = 0; i < joints; i++) {
+            std::copy(neuron_deg_abs[i].begin(), neuron_deg_abs[i].end(), decode_deg_abs.begin() + i * decode_stride);
+            std::copy(neuron_deg_rel[i].begin(), neuron_deg_rel[i].end(), decode_deg_rel.begin() + i * decode_stride);
+        }
+        encoder_buffer.resize(joints);
+
         this->type = "JointWriter";
         init_param["part"] = part;
         init_param["popsize"] = std::to_string(pop_size);
         init_param["deg_per_neuron"] = std::to_string(deg_per_neuron);
         init_param["speed"] = std::to_string(speed);
         init_param["ini_path"] = ini_path;
+        init_param["carrier"] = carrier;
         this->dev_init = true;
         return true;
     } else {
@@ -215,13 +237,14 @@ bool JointWriter::Init(std::string part, unsigned int pop_size, double deg_per_n
 }
 #ifdef _USE_GRPC
 bool JointWriter::InitGRPC(std::string part, unsigned int pop_size, std::vector<int> joint_select, std::string mode, bool blocking, double deg_per_neuron, double speed, std::string ini_path,
-                           std::string ip_address, unsigned int port) {
+                           std::string ip_address, unsigned int port, std::string carrier) {
     /*
         Initialize the joint Writer with given parameters
 
         params: std::string part        -- string representing the robot part, has to match iCub part naming {left_(arm/leg), right_(arm/leg), head, torso}
                 unsigned int pop_size   -- number of neurons per population, encoding each one joint angle; only works if parameter "deg_per_neuron" is not set
                 double deg_per_neuron   -- degree per neuron in the populations, encoding the joints angles; if set: population size depends on joint working range
+                string carrier          -- YARP carrier for the robot connections; empty: carrier option of the ini file
                 string ip_address
                 unsigned int port
 
@@ -229,7 +252,7 @@ bool JointWriter::InitGRPC(std::string part, unsigned int pop_size, std::vector<
     */
 
     if (!this->dev_init) {
-        if (this->Init(part, pop_size, deg_per_neuron, speed, ini_path)) {
+        if (this->Init(part, pop_size, deg_per_neuron, speed, ini_path, carrier)) {
             this->_ip_address = ip_address;
             this->_port = port;
             this->joint_source = std::make_unique<WriteClientInstance>(ip_address, port);
@@ -254,13 +277,14 @@ bool JointWriter::InitGRPC(std::string part, unsigned int pop_size, std::vector<
 }
 #else
 bool JointWriter::InitGRPC(std::string part, unsigned int pop_size, std::vector<int> joint_select, std::string mode, bool blocking, double deg_per_neuron, double speed, std::string ini_path,
-                           std::string ip_address, unsigned int port) {
+                           std::string ip_address, unsigned int port, std::string carrier) {
     /*
         Initialize the joint Writer with given parameters
 
         params: std::string part        -- string representing the robot part, has to match iCub part naming {left_(arm/leg), right_(arm/leg), head, torso}
                 unsigned int pop_size   -- number of neurons per population, encoding each one joint angle; only works if parameter "deg_per_neuron" is not set
                 double deg_per_neuron   -- degree per neuron in the populations, encoding the joints angles; if set: population size depends on joint working range
+                string carrier          -- YARP carrier for the robot connections; empty: carrier option of the ini file
                 string ip_address
                 unsigned int port
 
@@ -764,74 +788,19 @@ bool JointWriter::WritePopAll(std::vector<std::vector<double>> position_pops, st
             std::cerr << "[Joint Writer " << icub_part << "] Invalid joint count in population input!" << std::endl;
             return false;
         }
-
-        // execute motion dependent on selected mode
-        bool start = false;
-        if (mode == "abs") {
-            // Decode positions from populations
-            for (int i = 0; i < joints; i++) {
-                joint_angles[i] = Decode(position_pops[i], i, neuron_deg_abs);
-                if (std::isnan(joint_angles[i])) {
-                    std::cerr << "[Joint Writer " << icub_part << "] Invalid joint angle in population code!" << std::endl;
-                    return false;
-                }
-            }
-            // start motion
-            start = ipos->positionMove(joint_angles.data());
-            yarp::os::Time::delay(0.005);    // needed for correct execution of motion
-        } else if (mode == "rel") {
-            // Decode positions from populations
-            for (int i = 0; i < joints; i++) {
-                joint_angles[i] = Decode(position_pops[i], i, neuron_deg_rel);
-                if (std::isnan(joint_angles[i])) {
-                    std::cerr << "[Joint Writer " << icub_part << "] Invalid joint angle in population code!" << std::endl;
-                    return false;
-                }
-            }
-
-            // clamp to joint limits
-            std::vector<double> act_pos;
-            act_pos.resize(joints);
-            ienc->getEncoders(act_pos.data());
-            for (int i = 0; i <= joints; i++) {
-                double new_pos = act_pos[i] + joint_angles[i];
-                if (new_pos > joint_max[i]) {
-                    joint_angles[i] = joint_max[i] - act_pos[i];
-                }
-                if (new_pos < joint_min[i]) {
-                    joint_angles[i] = joint_min[i] - act_pos[i];
-                }
-            }
-
-            // start motion
-            start = ipos->relativeMove(joint_angles.data());
-            yarp::os::Time::delay(0.005);    // needed for correct execution of motion
-        } else {
+        if (mode != "abs" && mode != "rel") {
             std::cerr << "[Joint Writer " << icub_part << "] No valid motion mode is given. Possible options are 'abs' or 'rel' !" << std::endl;
+            return false;
         }
 
-        // move joints blocking/non-blocking
-        if (start) {
-            if (blocking) {
-                bool in_time = true;
-                bool motion = false;
-                time_t start_time = std::time(NULL);
-                while (!motion && in_time) {
-                    if (!ipos->checkMotionDone(&motion)) {
-                        std::cerr << "[Joint Writer " << icub_part << "] Communication error while moving occured!" << std::endl;
-                        return false;
-                    }
-                    yarp::os::Time::delay(0.005);
-                    if ((std::time(NULL) - start_time) > timeout && timeout > 0) {
-                        in_time = false;
-                        ipos->stop();
-                    }
-                }
+        // Decode positions from populations
+        bool relative = (mode == "rel");
+        for (int i = 0; i < joints; i++) {
+            if (!Decode(position_pops[i].data(), position_pops[i].size(), i, relative, joint_angles[i])) {
+                return false;
             }
-        } else {
-            std::cerr << "[Joint Writer " << icub_part << "] Could not start motion!" << std::endl;
         }
-        return start;
+        return MoveDecoded(joints, nullptr, relative, blocking, timeout);
     } else {
         return false;
     }
@@ -866,75 +835,24 @@ bool JointWriter::WritePopMultiple(std::vector<std::vector<double>> position_pop
             return false;
         }
 
-        // execute motion dependent on selected mode
-        bool start = false;
-        if (mode == "abs") {
-            // Decode positions from populations
-            for (unsigned int i = 0; i < joint_selection.size(); i++) {
-                joint_angles[i] = Decode(position_pops[i], joint_selection[i], neuron_deg_abs);
-                if (std::isnan(joint_angles[i])) {
-                    std::cerr << "[Joint Writer " << icub_part << "] Invalid joint angle in population code!" << std::endl;
-                    return false;
-                }
-            }
-            // start motion
-            start = ipos->positionMove(joint_selection.size(), joint_selection.data(), joint_angles.data());
-            yarp::os::Time::delay(0.005);    // needed for correct execution of motion
-
-        } else if (mode == "rel") {
-            // Decode positions from populations
-            for (unsigned int i = 0; i < joint_selection.size(); i++) {
-                joint_angles[i] = Decode(position_pops[i], joint_selection[i], neuron_deg_rel);
-                if (std::isnan(joint_angles[i])) {
-                    std::cerr << "[Joint Writer " << icub_part << "] Invalid joint angle in population code!" << std::endl;
-                    return false;
-                }
-            }
-            // clamp to joint limits
-            std::vector<double> act_pos;
-            act_pos.resize(joints);
-            ienc->getEncoders(act_pos.data());
-            int i = 0;
-            for (std::vector<int>::iterator it = joint_selection.begin(); it != joint_selection.end(); ++it) {
-                double new_pos = act_pos[*it] + joint_angles[i];
-                if (new_pos > joint_max[*it]) {
-                    joint_angles[i] = joint_max[*it] - act_pos[*it];
-                }
-                if (new_pos < joint_min[*it]) {
-                    joint_angles[i] = joint_min[*it] - act_pos[*it];
-                }
-                i++;
-            }
-            // start motion
-            start = ipos->relativeMove(joint_selection.size(), joint_selection.data(), joint_angles.data());
-            yarp::os::Time::delay(0.005);    // needed for correct execution of motion
+        if (*(std::min_element(joint_selection.begin(), joint_selection.end())) < 0) {
+            std::cerr << "[Joint Writer " << icub_part << "] Minimum joint number is out of range!" << std::endl;
+            return false;
+        }
 
-        } else {
+        if (mode != "abs" && mode != "rel") {
             std::cerr << "[Joint Writer " << icub_part << "] No valid motion mode is given. Possible options are 'abs' or 'rel' !" << std::endl;
+            return false;
         }
 
-        // move joints blocking/non-blocking
-        if (start) {
-            if (blocking) {
-                bool in_time = true;
-                bool motion = false;
-                time_t start_time = std::time(NULL);
-                while (!motion && in_time) {
-                    if (!ipos->checkMotionDone(&motion)) {
-                        std::cerr << "[Joint Writer " << icub_part << "] Communication error while moving occured!" << std::endl;
-                        return false;
-                    }
-                    yarp::os::Time::delay(0.005);
-                    if ((std::time(NULL) - start_time) > timeout && timeout > 0) {
-                        in_time = false;
-                        ipos->stop(joint_selection.size(), joint_selection.data());
-                    }
-                }
+        // Decode positions from populations
+        bool relative = (mode == "rel");
+        for (unsigned int i = 0; i < joint_selection.size(); i++) {
+            if (!Decode(position_pops[i].data(), position_pops[i].size(), joint_selection[i], relative, joint_angles[i])) {
+                return false;
             }
-        } else {
-            std::cerr << "[Joint Writer " << icub_part << "] Could not start motion!" << std::endl;
         }
-        return start;
+        return MoveDecoded(joint_selection.size(), joint_selection.data(), relative, blocking, timeout);
     } else {
         return false;
     }
@@ -963,9 +881,8 @@ bool JointWriter::WritePopOne(std::vector<double> position_pop, int joint, std::
         bool start = false;
         if (mode == "abs") {
             // Decode absolute position from population
-            double angle = Decode(position_pop, joint, neuron_deg_abs);
-            if (std::isnan(angle)) {
-                std::cerr << "[Joint Writer " << icub_part << "] Invalid joint angle in population code!" << std::endl;
+            double angle;
+            if (!Decode(position_pop.data(), position_pop.size(), joint, false, angle)) {
                 return false;
             }
             // start motion
@@ -973,9 +890,8 @@ bool JointWriter::WritePopOne(std::vector<double> position_pop, int joint, std::
             yarp::os::Time::delay(0.005);    // needed for correct execution of motion
         } else if (mode == "rel") {
             // Decode relative position from population
-            double angle = Decode(position_pop, joint, neuron_deg_rel);
-            if (std::isnan(angle)) {
-                std::cerr << "[Joint Writer " << icub_part << "] Invalid joint angle in population code!" << std::endl;
+            double angle;
+            if (!Decode(position_pop.data(), position_pop.size(), joint, true, angle)) {
                 return false;
             }
 
@@ -1024,7 +940,125 @@ bool JointWriter::WritePopOne(std::vector<double> position_pop, int joint, std::
     }
 }
 
-double JointWriter::Decode_ext(std::vector<double> position_pop, int joint) { return Decode(position_pop, joint, neuron_deg_abs); }
+bool JointWriter::WritePopAllArray(const double *position_pops, size_t size, unsigned int row_size, std::string mode, bool blocking, time_t timeout) {
+    /*
+        Write all joints with joint angles encoded in populations, given as one contiguous array
+
+        params: const double *position_pops -- contiguous populations, one row per joint
+                size_t size                 -- number of elements of the input
+                unsigned int row_size       -- number of values per joint row
+                string mode                 -- motion mode: absolute or relative
+                bool blocking               -- if True, function waits for end of motion
+
+        return: bool                        -- return True, if successful
+    */
+
+    if (CheckInit()) {
+        // Check population count
+        if (size != static_cast<size_t>(joints) * row_size) {
+            std::cerr << "[Joint Writer " << icub_part << "] Input size " << size << " does not fit the joint count " << joints << " x row size " << row_size << "!" << std::endl;
+            return false;
+        }
+        if (mode != "abs" && mode != "rel") {
+            std::cerr << "[Joint Writer " << icub_part << "] No valid motion mode is given. Possible options are 'abs' or 'rel' !" << std::endl;
+            return false;
+        }
+
+        // Decode positions from the population rows; the neurons behind the joint population are ignored
+        bool relative = (mode == "rel");
+        for (int i = 0; i < joints; i++) {
+            size_t neurons = relative ? neuron_deg_rel[i].size() : neuron_deg_abs[i].size();
+            if (neurons > row_size) {
+                std::cerr << "[Joint Writer " << icub_part << "] Row size " << row_size << " is smaller than the population of joint " << i << "!" << std::endl;
+                return false;
+            }
+            if (!Decode(position_pops + static_cast<size_t>(i) * row_size, neurons, i, relative, joint_angles[i])) {
+                return false;
+            }
+        }
+        return MoveDecoded(joints, nullptr, relative, blocking, timeout);
+    } else {
+        return false;
+    }
+}
+
+bool JointWriter::WritePopMultipleArray(const double *position_pops, size_t size, unsigned int row_size, std::vector<int> joint_selection, std::string mode,
+                                        bool blocking, time_t timeout) {
+    /*
+        Write multiple joints with joint angles encoded in populations, given as one contiguous array
+
+        params: const double *position_pops -- contiguous populations, one row per selected joint
+                size_t size                 -- number of elements of the input
+                unsigned int row_size       -- number of values per joint row
+                std::vector<int> joint      -- joint selection of the robot part
+                string mode                 -- motion mode: absolute or relative
+                bool blocking               -- if True, function waits for end of motion
+
+        return: bool                        -- return True, if successful
+    */
+
+    if (CheckInit()) {
+        // Check joint count
+        if (joint_selection.empty() || static_cast<int>(joint_selection.size()) > joints) {
+            std::cerr << "[Joint Writer " << icub_part << "] Invalid number of joints for the robot part!" << std::endl;
+            return false;
+        }
+
+        if (size != joint_selection.size() * row_size) {
+            std::cerr << "[Joint Writer " << icub_part << "] Input size " << size << " does not fit the joint count " << joint_selection.size() << " x row size " << row_size << "!" << std::endl;
+            return false;
+        }
+
+        if (*(std::max_element(joint_selection.begin(), joint_selection.end())) >= joints) {
+            std::cerr << "[Joint Writer " << icub_part << "] Maximum joint number is out of range!" << std::endl;
+            return false;
+        }
+
+        if (*(std::min_element(joint_selection.begin(), joint_selection.end())) < 0) {
+            std::cerr << "[Joint Writer " << icub_part << "] Minimum joint number is out of range!" << std::endl;
+            return false;
+        }
+
+        if (mode != "abs" && mode != "rel") {
+            std::cerr << "[Joint Writer " << icub_part << "] No valid motion mode is given. Possible options are 'abs' or 'rel' !" << std::endl;
+            return false;
+        }
+
+        // Decode positions from the population rows; the neurons behind the joint population are ignored
+        bool relative = (mode == "rel");
+        for (unsigned int i = 0; i < joint_selection.size(); i++) {
+            int joint = joint_selection[i];
+            size_t neurons = relative ? neuron_deg_rel[joint].size() : neuron_deg_abs[joint].size();
+            if (neurons > row_size) {
+                std::cerr << "[Joint Writer " << icub_part << "] Row size " << row_size << " is smaller than the population of joint " << joint << "!" << std::endl;
+                return false;
+            }
+            if (!Decode(position_pops + static_cast<size_t>(i) * row_size, neurons, joint, relative, joint_angles[i])) {
+                return false;
+            }
+        }
+        return MoveDecoded(joint_selection.size(), joint_selection.data(), relative, blocking, timeout);
+    } else {
+        return false;
+    }
+}
+
+double JointWriter::Decode_ext(std::vector<double> position_pop, int joint) {
+    /*
+        Decode the population coded joint angle to double value
+
+        params: std::vector<double>     -- population encoded joint angle
+                int joint               -- joint number of the robot part
+
+        return: double                  -- decoded joint angle; NaN if the population code is not valid
+    */
+
+    double angle = std::numeric_limits<double>::quiet_NaN();
+    if (this->dev_init && joint >= 0 && joint < joints) {
+        Decode(position_pop.data(), position_pop.size(), joint, false, angle);
+    }
+    return angle;
+}
 
 /*** gRPC related functions ***/
 #ifdef _USE_GRPC
@@ -1041,24 +1075,20 @@ void JointWriter::Write_ANNarchy_Input_SJ_enc() { WritePopOne(joint_value_1dvect
 void JointWriter::Retrieve_ANNarchy_Input_MJ() { joint_value_1dvector = joint_source->retrieve_multitarget(); }
 void JointWriter::Write_ANNarchy_Input_MJ() { WriteDoubleMultiple(joint_value_1dvector, _joint_select, _mode, _blocking, 0); }
 
-void JointWriter::Retrieve_ANNarchy_Input_MJ_enc() {
-    joint_value_1dvector = joint_source->retrieve_multitarget_enc();
-    for (unsigned int i = 0; i < joint_value_1dvector.size(); i += pop_size) {
-        joint_value_2dvector.push_back(std::vector<double>((joint_value_1dvector.begin() + i), (joint_value_1dvector.begin() + i + pop_size + 1)));
-    }
+void JointWriter::Retrieve_ANNarchy_Input_MJ_enc() { joint_value_1dvector = joint_source->retrieve_multitarget_enc(); }
+void JointWriter::Write_ANNarchy_Input_MJ_enc() {
+    // the populations of the selected joints are received concatenated -> decoded without copy
+    WritePopConcat(joint_value_1dvector.data(), joint_value_1dvector.size(), _joint_select.size(), _joint_select.data(), _mode, _blocking, 0);
 }
-void JointWriter::Write_ANNarchy_Input_MJ_enc() { WritePopMultiple(joint_value_2dvector, _joint_select, _mode, _blocking, 0); }
 
 void JointWriter::Retrieve_ANNarchy_Input_AJ() { joint_value_1dvector = joint_source->retrieve_alltarget(); }
 void JointWriter::Write_ANNarchy_Input_AJ() { WriteDoubleAll(joint_value_1dvector, _mode, _blocking, 0); }
 
-void JointWriter::Retrieve_ANNarchy_Input_AJ_enc() {
-    joint_value_1dvector = joint_source->retrieve_alltarget_enc();
-    for (unsigned int i = 0; i < joint_value_1dvector.size(); i += pop_size) {
-        joint_value_2dvector.push_back(std::vector<double>((joint_value_1dvector.begin() + i), (joint_value_1dvector.begin() + i + pop_size + 1)));
-    }
+void JointWriter::Retrieve_ANNarchy_Input_AJ_enc() { joint_value_1dvector = joint_source->retrieve_alltarget_enc(); }
+void JointWriter::Write_ANNarchy_Input_AJ_enc() {
+    // the populations of all joints are received concatenated -> decoded without copy
+    WritePopConcat(joint_value_1dvector.data(), joint_value_1dvector.size(), joints, nullptr, _mode, _blocking, 0);
 }
-void JointWriter::Write_ANNarchy_Input_AJ_enc() { WritePopAll(joint_value_2dvector, _mode, _blocking, 0); }
 #else
 void JointWriter::Retrieve_ANNarchy_Input_SJ() { std::cerr << "[Joint Writer] gRPC is not included in the setup process!" << std::endl; }
 void JointWriter::Write_ANNarchy_Input_SJ() { std::cerr << "[Joint Writer] gRPC is not included in the setup process!" << std::endl; }
@@ -1094,23 +1124,204 @@ bool JointWriter::CheckPartKey(std::string key) {
     return inside;
 }
 
-double JointWriter::Decode(std::vector<double> position_pop, int joint, std::vector<std::vector<double>> neuron_deg) {
+static void DecodeSums(const double *__restrict pop, const double *__restrict deg, size_t size, double &sum_w, double &sum) {
     /*
-        Decode the population coded joint angle to double value
+        Sum up the population activity and the activity weighted with the neuron degree values
+
+        params: const double *pop               -- population activity
+                const double *deg               -- degree values of the neurons
+                size_t size                     -- number of neurons
+                double &sum_w                   -- weighted activity sum
+                double &sum                     -- activity sum
+    */
+
+    // independent partial sums -> vectorized without reordering the floating point sums (no -ffast-math)
+    constexpr size_t lanes = 8;
+    double acc_w[lanes] = {}, acc[lanes] = {};
+    size_t j = 0;
+    for (; j + lanes <= size; j += lanes) {
+        for (size_t k = 0; k < lanes; k++) {
+            acc_w[k] += pop[j + k] * deg[j + k];
+            acc[k] += pop[j + k];
+        }
+    }
+    for (; j < size; j++) {
+        acc_w[0] += pop[j] * deg[j];
+        acc[0] += pop[j];
+    }
+    sum_w = 0.;
+    sum = 0.;
+    for (size_t k = 0; k < lanes; k++) {
+        sum_w += acc_w[k];
+        sum += acc[k];
+    }
+}
+
+bool JointWriter::Decode(const double *position_pop, size_t size, int joint, bool relative, double &angle) {
+    /*
+        Decode the population coded joint angle to double value; the weighted sums use the contiguous degree table of the joints
 
-        params: std::vector<double>             -- population encoded joint angle
+        params: const double *position_pop      -- population encoded joint angle
+                size_t size                     -- number of neurons of the population input; has to match the joint population
                 int joint                       -- joint number of the robot part
+                bool relative                   -- true: relative joint angle population; false: absolute joint angle population
+                double &angle                   -- decoded joint angle; population without activity: current joint angle (absolute) or 0 (relative)
 
-        return: double joint_angle              -- decoded joint angle
+        return: bool                            -- return True, if the population code is valid
     */
 
-    double sum_pop_w = 0;
-    double sum_pop = 0;
-    for (unsigned int i = 0; i < position_pop.size(); i++) {
-        sum_pop_w = sum_pop_w + position_pop[i] * neuron_deg[joint][i];
-        sum_pop = sum_pop + position_pop[i];
+    size_t neurons = relative ? neuron_deg_rel[joint].size() : neuron_deg_abs[joint].size();
+    if (size != neurons) {
+        std::cerr << "[Joint Writer " << icub_part << "] Population size " << size << " does not match the population of joint " << joint << " (" << neurons << ")!" << std::endl;
+        return false;
+    }
+
+    const auto &table = relative ? decode_deg_rel : decode_deg_abs;
+    double sum_pop_w, sum_pop;
+    DecodeSums(position_pop, table.data() + joint * decode_stride, size, sum_pop_w, sum_pop);
+    if (!std::isfinite(sum_pop_w) || !std::isfinite(sum_pop)) {
+        std::cerr << "[Joint Writer " << icub_part << "] Invalid joint angle in population code!" << std::endl;
+        return false;
+    }
+
+    if (sum_pop > 0.) {
+        angle = sum_pop_w / sum_pop;
+    } else if (relative) {
+        // no activity -> no motion
+        angle = 0.;
+    } else {
+        // no activity -> the joint keeps its position
+        if (!ienc->getEncoder(joint, &angle)) {
+            std::cerr << "[Joint Writer " << icub_part << "] Could not read the current angle of joint " << joint << "!" << std::endl;
+            return false;
+        }
+    }
+    return true;
+}
+
+bool JointWriter::WritePopConcat(const double *position_pops, size_t size, int count, int *joint_selection, std::string mode, bool blocking, time_t timeout) {
+    /*
+        Write the joints with joint angles encoded in concatenated populations; each population has the size of its joint population
+
+        params: const double *position_pops     -- concatenated populations of the joints in the order of the selection
+                size_t size                     -- number of elements of the input
+                int count                       -- number of written joints
+                int *joint_selection            -- joint numbers of the written joints; nullptr -> all joints
+                string mode                     -- motion mode: absolute or relative
+                bool blocking                   -- if True, function waits for end of motion
+                time_t timeout                  -- time in seconds, to wait for motion execution
+
+        return: bool                            -- return True, if successful
+    */
+
+    if (!CheckInit()) {
+        return false;
+    }
+    if (count <= 0 || count > joints) {
+        std::cerr << "[Joint Writer " << icub_part << "] Invalid number of joints for the robot part!" << std::endl;
+        return false;
+    }
+    if (mode != "abs" && mode != "rel") {
+        std::cerr << "[Joint Writer " << icub_part << "] No valid motion mode is given. Possible options are 'abs' or 'rel' !" << std::endl;
+        return false;
+    }
+
+    // offsets of the populations follow from the joint population sizes (deg_per_neuron -> different sizes)
+    bool relative = (mode == "rel");
+    size_t offset = 0;
+    for (int i = 0; i < count; i++) {
+        int joint = (joint_selection == nullptr) ? i : joint_selection[i];
+        if (joint < 0 || joint >= joints) {
+            std::cerr << "[Joint Writer " << icub_part << "] Selected joint <" << joint << "> is out of range!" << std::endl;
+            return false;
+        }
+        size_t neurons = relative ? neuron_deg_rel[joint].size() : neuron_deg_abs[joint].size();
+        if (offset + neurons > size) {
+            std::cerr << "[Joint Writer " << icub_part << "] Input size " << size << " is smaller than the populations of the joints!" << std::endl;
+            return false;
+        }
+        if (!Decode(position_pops + offset, neurons, joint, relative, joint_angles[i])) {
+            return false;
+        }
+        offset += neurons;
+    }
+    if (offset != size) {
+        std::cerr << "[Joint Writer " << icub_part << "] Input size " << size << " does not match the populations of the joints (" << offset << ")!" << std::endl;
+        return false;
+    }
+    return MoveDecoded(count, joint_selection, relative, blocking, timeout);
+}
+
+bool JointWriter::MoveDecoded(int count, int *joint_selection, bool relative, bool blocking, time_t timeout) {
+    /*
+        Move the joints to the decoded joint angles in joint_angles
+
+        params: int count                       -- number of moved joints
+                int *joint_selection            -- joint numbers of the moved joints; nullptr -> all joints
+                bool relative                   -- true: relative motion; false: absolute motion
+                bool blocking                   -- if True, function waits for end of motion
+                time_t timeout                  -- time in seconds, to wait for motion execution
+
+        return: bool                            -- return True, if the motion was started
+    */
+
+    bool start = false;
+    if (!relative) {
+        // start motion
+        if (joint_selection == nullptr) {
+            start = ipos->positionMove(joint_angles.data());
+        } else {
+            start = ipos->positionMove(count, joint_selection, joint_angles.data());
+        }
+        yarp::os::Time::delay(0.005);    // needed for correct execution of motion
+    } else {
+        // clamp to joint limits
+        ienc->getEncoders(encoder_buffer.data());
+        for (int i = 0; i < count; i++) {
+            int joint = (joint_selection == nullptr) ? i : joint_selection[i];
+            double new_pos = encoder_buffer[joint] + joint_angles[i];
+            if (new_pos > joint_max[joint]) {
+                joint_angles[i] = joint_max[joint] - encoder_buffer[joint];
+            }
+            if (new_pos < joint_min[joint]) {
+                joint_angles[i] = joint_min[joint] - encoder_buffer[joint];
+            }
+        }
+        // start motion
+        if (joint_selection == nullptr) {
+            start = ipos->relativeMove(joint_angles.data());
+        } else {
+            start = ipos->relativeMove(count, joint_selection, joint_angles.data());
+        }
+        yarp::os::Time::delay(0.005);    // needed for correct execution of motion
+    }
+
+    // move joints blocking/non-blocking
+    if (start) {
+        if (blocking) {
+            bool in_time = true;
+            bool motion = false;
+            time_t start_time = std::time(NULL);
+            while (!motion && in_time) {
+                if (!ipos->checkMotionDone(&motion)) {
+                    std::cerr << "[Joint Writer " << icub_part << "] Communication error while moving occured!" << std::endl;
+                    return false;
+                }
+                yarp::os::Time::delay(0.005);
+                if ((std::time(NULL) - start_time) > timeout && timeout > 0) {
+                    in_time = false;
+                    if (joint_selection == nullptr) {
+                        ipos->stop();
+                    } else {
+                        ipos->stop(count, joint_selection);
+                    }
+                }
+            }
+        }
+    } else {
+        std::cerr << "[Joint Writer " << icub_part << "] Could not start motion!" << std::endl;
     }
-    return sum_pop_w / sum_pop;
+    return start;
 }
 
 bool JointWriter::MotionDone() {
@@ -44,11 +44,12 @@
 KinematicReader::~KinematicReader() { Close(); }
 
 /*** public methods for the user ***/
-bool KinematicReader::Init(std::string part, float version, std::string ini_path, bool offline_mode) {
+bool KinematicReader::Init(std::string part, float version, std::string ini_path, bool offline_mode, std::string carrier) {
     /*
         Initialize the Kinematic Reader with given parameters
 
         params: std::string part        -- string representing the robot part, has to match iCub part naming {left_(arm/leg), right_(arm/leg), head, torso}
+                string carrier          -- YARP carrier for the robot connections; empty: carrier option of the ini file
 
         return: bool                    -- return True, if successful
     */
@@ -88,6 +89,9 @@ bool KinematicReader::Init(std::string part, float version, std::string ini_path
         std::string robot_port_prefix = reader_gen.Get("general", "robot_port_prefix", "/icubSim");
         std::string client_port_prefix = reader_gen.Get("general", "client_port_prefix", "/client");
 
+        // carrier of the torso and arm control board connections; [kinematics] or [general] ini option, if the argument is empty
+        std::string port_carrier = carrier.empty() ? reader_gen.Get("kinematics", "carrier", reader_gen.Get("general", "carrier", "")) : carrier;
+
         if (part == "right_arm" || part == "left_arm") {
             std::string::size_type i = part.find("_arm");
             std::string descriptor = part.substr(0, i);
@@ -112,6 +116,9 @@ bool KinematicReader::Init(std::string part, float version, std::string ini_path
                 options_torso.put("device", "remote_controlboard");
                 options_torso.put("remote", (robot_port_prefix + "/torso").c_str());
                 options_torso.put("local", (client_port_prefix + "/ANNarchy_Kin_read_" + std::to_string(std::time(NULL)) + "/torso").c_str());
+                if (!port_carrier.empty()) {
+                    options_torso.put("carrier", port_carrier);
+                }
 
                 if (!driver_torso.open(options_torso)) {
                     std::cerr << "[Kinematic Reader torso] Unable to open " << options_torso.find("device").asString() << "!" << std::endl;
@@ -140,6 +147,9 @@ bool KinematicReader::Init(std::string part, float version, std::string ini_path
                 options_arm.put("device", "remote_controlboard");
                 options_arm.put("remote", (robot_port_prefix + "/" + part).c_str());
                 options_arm.put("local", (client_port_prefix + "/ANNarchy_Kin_read_" + std::to_string(std::time(NULL)) + "/" + part).c_str());
+                if (!port_carrier.empty()) {
+                    options_arm.put("carrier", port_carrier);
+                }
 
                 if (!driver_arm.open(options_arm)) {
                     std::cerr << "[Kinematic Reader " << part << "] Unable to open " << options_arm.find("device").asString() << "!" << std::endl;
@@ -172,6 +182,7 @@ bool KinematicReader::Init(std::string part, float version, std::string ini_path
         init_param["part"] = part;
         init_param["version"] = std::to_string(version);
         init_param["ini_path"] = ini_path;
+        init_param["carrier"] = carrier;
         init_param["offline_mode"] = std::to_string(offline_mode);
         this->dev_init = true;
         return true;
@@ -182,19 +193,20 @@ bool KinematicReader::Init(std::string part, float version, std::string ini_path
 }
 
 #ifdef _USE_GRPC
-bool KinematicReader::InitGRPC(std::string part, float version, std::string ini_path, std::string ip_address, unsigned int port, bool offline_mode) {
+bool KinematicReader::InitGRPC(std::string part, float version, std::string ini_path, std::string ip_address, unsigned int port, bool offline_mode, std::string carrier) {
     /*
         Initialize the Kinematic Reader with given parameters
 
         params: std::string part        -- string representing the robot part, has to match iCub part naming {left_(arm/leg), right_(arm/leg), head, torso}
                 string ip_address       -- gRPC server ip address
                 unsigned int port       -- gRPC server port
+                string carrier          -- YARP carrier for the robot connections; empty: carrier option of the ini file
 
         return: bool                    -- return True, if successful
     */
 
     if (!this->dev_init) {
-        if (this->Init(part, version, ini_path, offline_mode)) {
+        if (this->Init(part, version, ini_path, offline_mode, carrier)) {
             this->_ip_address = ip_address;
             this->_port = port;
             this->kin_source = new ServerInstance(ip_address, port, this);
@@ -213,13 +225,14 @@ bool KinematicReader::InitGRPC(std::string part, float version, std::string ini_
     }
 }
 #else
-bool KinematicReader::InitGRPC(std::string part, float version, std::string ini_path, std::string ip_address, unsigned int port, bool offline_mode) {
+bool KinematicReader::InitGRPC(std::string part, float version, std::string ini_path, std::string ip_address, unsigned int port, bool offline_mode, std::string carrier) {
     /*
         Initialize the Kinematic Reader with given parameters
 
         params: std::string part        -- string representing the robot part, has to match iCub part naming {left_(arm/leg), right_(arm/leg), head, torso}
                 string ip_address       -- gRPC server ip address
                 unsigned int port       -- gRPC server port
+                string carrier          -- YARP carrier for the robot connections; empty: carrier option of the ini file
 
         return: bool                    -- return True, if successful
     */
@@ -27,14 +27,14 @@ Mod_BaseClass::~Mod_BaseClass() {}
 
 bool Mod_BaseClass::CheckInit() {
     /*
-        Check if the init function was called and module is registered at the main Interface
+        Check if the init function was called and module is registered at the main Interface or used standalone
     */
     if (!dev_init) {
         std::cerr << "[" << type << "] Error: Device is not initialized!" << std::endl;
-    } else if (!registered) {
+    } else if (!registered && !standalone) {
         std::cerr << "[" << type << ": " << icub_part << "] Error: Device is not registered!" << std::endl;
     }
-    return dev_init & registered;
+    return dev_init && (registered || standalone);
 }
 
 void Mod_BaseClass::Close() { std::cerr << "[" << type << "] Error: Close method not implemented!" << std::endl; }
@@ -42,6 +42,9 @@ void Mod_BaseClass::Close() { std::cerr << "[" << type << "] Error: Close method
 void Mod_BaseClass::setRegister(bool value) { registered = value; }
 bool Mod_BaseClass::getRegister() { return registered; }
 
+void Mod_BaseClass::setStandalone(bool value) { standalone = value; }
+bool Mod_BaseClass::getStandalone() { return standalone; }
+
 std::string Mod_BaseClass::get_identifier() { return type + ": " + icub_part; }
 std::map<std::string, std::string> Mod_BaseClass::getParameter() { return init_param; }
 
@@ -74,7 +77,28 @@ std::vector<double> Mod_BaseClass::provideData(bool enc) {
     return std::vector<double>();
 }
 
+std::vector<double> Mod_BaseClass::provideSparseData(std::vector<int>& start, std::vector<int>& count) {
+    std::cerr << "[" << type << "] Error: provideSparseData method not implemented!" << std::endl;
+    return std::vector<double>();
+}
+
+std::vector<double> Mod_BaseClass::provideChangedData(uint64_t consumer, bool enc, bool sparse, bool resync, std::vector<int>& joint, std::vector<int>& start,
+                                                      std::vector<int>& count) {
+    std::cerr << "[" << type << "] Error: provideChangedData method not implemented!" << std::endl;
+    return std::vector<double>();
+}
+
 std::vector<double> Mod_BaseClass::provideData(int value) {
     std::cerr << "[" << type << "] Error: provideData method not implemented!" << std::endl;
     return std::vector<double>();
 }
+
+std::vector<uint8_t> Mod_BaseClass::provideRawData() {
+    std::cerr << "[" << type << "] Error: provideRawData method not implemented!" << std::endl;
+    return std::vector<uint8_t>();
+}
+
+std::vector<int> Mod_BaseClass::provideImageGeometry() {
+    std::cerr << "[" << type << "] Error: provideImageGeometry method not implemented!" << std::endl;
+    return std::vector<int>();
+}
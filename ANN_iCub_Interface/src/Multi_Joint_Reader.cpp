@@ -0,0 +1,274 @@
+/*
+ *  Copyright (C) 2019-2024 Torsten Fietzek
+ *
+ *  Multi_Joint_Reader.cpp is part of the ANNarchy iCub interface
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  The ANNarchy iCub interface is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this headers. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "Multi_Joint_Reader.hpp"
+
+#include <algorithm>
+#include <future>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include "Joint_Reader.hpp"
+#include "Module_Base_Class.hpp"
+#include "Thread_Pool.hpp"
+
+// Destructor
+MultiJointReader::~MultiJointReader() { Close(); }
+
+/*** public methods for the user ***/
+bool MultiJointReader::Init(std::vector<std::string> parts, double sigma, unsigned int pop_size, double deg_per_neuron, std::string ini_path, std::string carrier, std::string coding) {
+    /*
+        Initialize the multi-part joint reader with given parameters
+
+        params: std::vector<string> parts   -- robot parts in the output order
+                double sigma                -- sigma for the joints angles populations coding
+                unsigned int pop_size       -- number of neurons per population, encoding each one joint angle; only works if parameter "deg_per_neuron" is not set
+                double deg_per_neuron       -- degree per neuron in the populations, encoding the joints angles; if set: population size depends on joint working range
+                std::string ini_path        -- path to the "interface_param.ini"-file
+                std::string carrier         -- YARP carrier for the robot connections; empty: carrier option of the ini file
+                std::string coding          -- population coding of the joint angles: gaussian, von_mises or thermometer
+
+        return: bool                        -- return True, if successful
+    */
+
+    if (this->dev_init) {
+        std::cerr << "[Multi Joint Reader] Initialization aborted: Reader is already initialized!" << std::endl;
+        return false;
+    }
+    if (parts.empty()) {
+        std::cerr << "[Multi Joint Reader] No robot part given!" << std::endl;
+        return false;
+    }
+    for (size_t i = 0; i < parts.size(); i++) {
+        if (std::find(parts.begin() + i + 1, parts.end(), parts[i]) != parts.end()) {
+            std::cerr << "[Multi Joint Reader] Robot part " << parts[i] << " is given twice!" << std::endl;
+            return false;
+        }
+    }
+
+    // one joint reader per part -> every part has its own control board driver
+    offsets.assign(1, 0);
+    max_neurons = 0;
+    for (auto &part : parts) {
+        auto reader = std::make_unique<JointReader>();
+        if (!reader->Init(part, sigma, pop_size, deg_per_neuron, ini_path, carrier, coding)) {
+            std::cerr << "[Multi Joint Reader] Initialization of the part " << part << " failed!" << std::endl;
+            readers.clear();
+            offsets.clear();
+            return false;
+        }
+        // the part readers are owned by this module and not registered at the main Interface
+        reader->setStandalone(true);
+        offsets.push_back(offsets.back() + reader->GetJointCount());
+        max_neurons = std::max(max_neurons, reader->GetMaxNeuronsPerJoint());
+        readers.push_back(std::move(reader));
+    }
+    if (readers.size() > 1) {
+        pool = std::make_unique<ThreadPool>(readers.size() - 1);
+    }
+
+    this->parts = parts;
+    std::string part_list;
+    for (auto &part : parts) {
+        part_list += (part_list.empty() ? "" : ",") + part;
+    }
+    this->type = "MultiJointReader";
+    icub_part = part_list;
+    init_param["parts"] = part_list;
+    init_param["sigma"] = std::to_string(sigma);
+    init_param["popsize"] = std::to_string(pop_size);
+    if (deg_per_neuron > 0.0) {
+        init_param["deg_per_neuron"] = std::to_string(deg_per_neuron);
+    }
+    init_param["ini_path"] = ini_path;
+    init_param["carrier"] = carrier;
+    init_param["coding"] = coding;
+
+    // the multi-part reader is not registered at the main Interface
+    setStandalone(true);
+    this->dev_init = true;
+    return true;
+}
+
+void MultiJointReader::Close() {
+    /*
+        Close multi-part joint reader with cleanup
+    */
+
+    // stop the workers first -> no reading in progress while the drivers are closed
+    pool.reset();
+    for (auto &reader : readers) {
+        reader->Close();
+    }
+    readers.clear();
+    parts.clear();
+    offsets.clear();
+    max_neurons = 0;
+
+    this->dev_init = false;
+}
+
+bool MultiJointReader::SetSamplingMode(bool threaded, double rate) {
+    /*
+        Select the sampling mode of all parts
+
+        params: bool threaded           -- true: background sampling; false: every reading requests the joint angles from the robot
+                double rate             -- sampling rate in Hz of the background sampling
+
+        return: bool                    -- return True, if successful
+    */
+
+    if (!CheckInit()) {
+        return false;
+    }
+    bool success = true;
+    for (auto &reader : readers) {
+        success &= reader->SetSamplingMode(threaded, rate);
+    }
+    return success;
+}
+
+std::vector<std::string> MultiJointReader::GetParts() {
+    /*
+        Return the robot parts in the output order
+
+        return: std::vector<std::string>    -- robot parts
+    */
+
+    return parts;
+}
+
+int MultiJointReader::GetJointCount() {
+    /*
+        Return the number of joints of all parts
+
+        return: int                     -- number of joints
+    */
+
+    if (CheckInit()) {
+        return offsets.back();
+    } else {
+        return 0;
+    }
+}
+
+std::vector<int> MultiJointReader::GetJointOffsets() {
+    /*
+        Return the offset table of the parts
+
+        return: std::vector<int>        -- index of the first joint of every part in the output; last value: number of joints
+    */
+
+    return offsets;
+}
+
+unsigned int MultiJointReader::GetMaxNeuronsPerJoint() {
+    /*
+        Return the size of the largest joint population of all parts
+
+        return: unsigned int            -- number of neurons of the largest population
+    */
+
+    return max_neurons;
+}
+
+std::vector<double> MultiJointReader::ReadDoubleAll() {
+    /*
+        Read all joints of all parts and return joint angles directly as double value
+
+        return: std::vector<double>     -- joint angles read from the robot
+    */
+
+    std::vector<double> angles;
+    if (CheckInit()) {
+        angles.resize(offsets.back());
+        if (!ReadDoubleAllInto(angles.data(), angles.size())) {
+            angles.clear();
+        }
+    }
+    return angles;
+}
+
+bool MultiJointReader::ReadDoubleAllInto(double *buffer, size_t size) {
+    /*
+        Read all joints of all parts and write the joint angles into a preallocated buffer
+
+        params: double *buffer          -- output buffer for the joint angles in the order of the offset table
+                size_t size             -- number of elements of the buffer
+
+        return: bool                    -- return True, if successful
+    */
+
+    if (!CheckInit()) {
+        return false;
+    }
+    if (size != static_cast<size_t>(offsets.back())) {
+        std::cerr << "[Multi Joint Reader] Buffer size " << size << " does not match the joint count " << offsets.back() << "!" << std::endl;
+        return false;
+    }
+
+    return ReadParts([this, buffer](size_t i) { return readers[i]->ReadDoubleAllInto(buffer + offsets[i], offsets[i + 1] - offsets[i]); });
+}
+
+bool MultiJointReader::ReadPopAllInto(double *buffer, size_t size) {
+    /*
+        Read all joints of all parts and write the joint angles encoded in populations into a preallocated buffer
+
+        params: double *buffer          -- output buffer for joints x max_neurons values; rows of smaller populations are zero padded
+                size_t size             -- number of elements of the buffer
+
+        return: bool                    -- return True, if successful
+    */
+
+    if (!CheckInit()) {
+        return false;
+    }
+    if (size != static_cast<size_t>(offsets.back()) * max_neurons) {
+        std::cerr << "[Multi Joint Reader] Buffer size " << size << " does not match the population buffer size " << static_cast<size_t>(offsets.back()) * max_neurons << "!" << std::endl;
+        return false;
+    }
+
+    return ReadParts([this, buffer](size_t i) {
+        return readers[i]->ReadPopAllInto(buffer + static_cast<size_t>(offsets[i]) * max_neurons, static_cast<size_t>(offsets[i + 1] - offsets[i]) * max_neurons, max_neurons);
+    });
+}
+
+/*** auxilary methods ***/
+template <typename F>
+bool MultiJointReader::ReadParts(F &&read) {
+    /*
+        Run the reading of every part concurrently; the parts are read by the workers, the last part by the calling thread
+
+        params: F read                  -- reading of part i, returning true on success
+
+        return: bool                    -- return True, if all parts were read successfully
+    */
+
+    std::vector<std::future<bool>> pending;
+    pending.reserve(readers.size() - 1);
+    for (size_t i = 0; i < readers.size() - 1; i++) {
+        pending.push_back(pool->Submit([&read, i]() { return read(i); }));
+    }
+    bool success = read(readers.size() - 1);
+    for (auto &task : pending) {
+        success &= task.get();
+    }
+    return success;
+}
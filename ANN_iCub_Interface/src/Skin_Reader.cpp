@@ -43,13 +43,14 @@
 SkinReader::~SkinReader() { Close(); }
 
 /*** public methods for the user ***/
-bool SkinReader::Init(std::string name, char arm, bool norm_data, std::string ini_path) {
+bool SkinReader::Init(std::string name, char arm, bool norm_data, std::string ini_path, std::string carrier) {
     /*
         Init skin reader with given parameters
 
         params: char arm        -- character to choose the arm side (r/R for right; l/L for left)
                 bool norm_data  -- true for normalized tactile data (iCub data: [0..255]; normalized [0..1.0])
                 ini_path        -- Path to the "interface_param.ini"-file
+                string carrier  -- YARP carrier for the robot connections; empty: carrier option of the ini file
 
         return: bool            -- return True, if successful
     */
@@ -127,13 +128,16 @@ bool SkinReader::Init(std::string name, char arm, bool norm_data, std::string in
         }
         std::string client_port_prefix = reader_gen.Get("general", "client_port_prefix", "/client");
 
+        // carrier of the skin sensor connections; [skin] or [general] ini option, if the argument is empty
+        std::string port_carrier = carrier.empty() ? reader_gen.Get("skin", "carrier", reader_gen.Get("general", "carrier", "")) : carrier;
+
         // Open and connect YARP-Port to read upper arm skin sensor data
         std::string port_name_arm = client_port_prefix + "/" + name + "/Skin_Reader_" + norm + "/" + side + "_arm_" + std::to_string(std::time(NULL)) + ":i";
         if (!port_arm.open(port_name_arm)) {
             std::cerr << "[Skin Reader " << side << "] Could not open skin arm port!" << std::endl;
             return false;
         }
-        if (!yarp::os::Network::connect((robot_port_prefix + "/skin/" + side + "_arm_comp").c_str(), port_name_arm.c_str())) {
+        if (!yarp::os::Network::connect((robot_port_prefix + "/skin/" + side + "_arm_comp").c_str(), port_name_arm.c_str(), port_carrier)) {
             std::cerr << "[Skin Reader " << side << "] Could not connect skin arm port!" << std::endl;
             return false;
         }
@@ -144,7 +148,7 @@ bool SkinReader::Init(std::string name, char arm, bool norm_data, std::string in
             std::cerr << "[Skin Reader" << side << "] Could not open skin forearm port!" << std::endl;
             return false;
         }
-        if (!yarp::os::Network::connect((robot_port_prefix + "/skin/" + side + "_forearm_comp").c_str(), port_name_farm.c_str())) {
+        if (!yarp::os::Network::connect((robot_port_prefix + "/skin/" + side + "_forearm_comp").c_str(), port_name_farm.c_str(), port_carrier)) {
             std::cerr << "[Skin Reader " << side << "] Could not connect skin forearm port!" << std::endl;
             return false;
         }
@@ -155,7 +159,7 @@ bool SkinReader::Init(std::string name, char arm, bool norm_data, std::string in
             std::cerr << "[Skin Reader " << side << "] Could not open skin hand port!" << std::endl;
             return false;
         }
-        if (!yarp::os::Network::connect((robot_port_prefix + "/skin/" + side + "_hand_comp").c_str(), port_name_hand.c_str())) {
+        if (!yarp::os::Network::connect((robot_port_prefix + "/skin/" + side + "_hand_comp").c_str(), port_name_hand.c_str(), port_carrier)) {
             std::cerr << "[Skin Reader " << side << "] Could not connect skin hand port!" << std::endl;
             return false;
         }
@@ -184,6 +188,7 @@ bool SkinReader::Init(std::string name, char arm, bool norm_data, std::string in
         init_param["arm"] = arm;
         init_param["norm"] = std::to_string(norm_data);
         init_param["ini_path"] = ini_path;
+        init_param["carrier"] = carrier;
         this->dev_init = true;
         return true;
     } else {
@@ -193,9 +198,9 @@ bool SkinReader::Init(std::string name, char arm, bool norm_data, std::string in
 }
 
 #ifdef _USE_GRPC
-bool SkinReader::InitGRPC(std::string name, char arm, bool norm_data, std::string ini_path, std::string ip_address, unsigned int port) {
+bool SkinReader::InitGRPC(std::string name, char arm, bool norm_data, std::string ini_path, std::string ip_address, unsigned int port, std::string carrier) {
     if (!this->dev_init) {
-        if (this->Init(name, arm, norm_data, ini_path)) {
+        if (this->Init(name, arm, norm_data, ini_path, carrier)) {
             this->_ip_address = ip_address;
             this->_port = port;
             this->skin_source = new ServerInstance(ip_address, port, this);
@@ -214,7 +219,7 @@ bool SkinReader::InitGRPC(std::string name, char arm, bool norm_data, std::strin
     }
 }
 #else
-bool SkinReader::InitGRPC(std::string name, char arm, bool norm_data, std::string ini_path, std::string ip_address, unsigned int port) {
+bool SkinReader::InitGRPC(std::string name, char arm, bool norm_data, std::string ini_path, std::string ip_address, unsigned int port, std::string carrier) {
     std::cerr << "[Skin Reader] gRPC is not included in the setup process!" << std::endl;
     return false;
 }
@@ -0,0 +1,156 @@
+/*
+ *  Copyright (C) 2019-2024 Torsten Fietzek
+ *
+ *  Thread_Pool.cpp is part of the ANNarchy iCub interface
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  The ANNarchy iCub interface is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this headers. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "Thread_Pool.hpp"
+
+#include <functional>
+#include <mutex>
+#include <thread>
+
+ThreadPool::ThreadPool(unsigned int n_threads) {
+    /*
+        Start the worker threads
+
+        params: unsigned int n_threads      -- number of worker threads
+    */
+
+    workers.reserve(n_threads);
+    for (unsigned int i = 0; i < n_threads; i++) {
+        workers.emplace_back(&ThreadPool::WorkerLoop, this);
+    }
+}
+
+ThreadPool::~ThreadPool() {
+    /*
+        Finish the queued tasks and stop the worker threads
+    */
+
+    {
+        std::lock_guard<std::mutex> lock(queue_mutex);
+        stop = true;
+    }
+    queue_cond.notify_all();
+    for (auto &worker : workers) {
+        if (worker.joinable()) {
+            worker.join();
+        }
+    }
+}
+
+void ThreadPool::WorkerLoop() {
+    /*
+        Take tasks from the queue and execute them until the pool is stopped and the queue is empty
+    */
+
+    while (true) {
+        std::function<void()> task;
+        {
+            std::unique_lock<std::mutex> lock(queue_mutex);
+            queue_cond.wait(lock, [this] { return stop || !tasks.empty(); });
+            if (stop && tasks.empty()) {
+                return;
+            }
+            task = std::move(tasks.front());
+            tasks.pop();
+        }
+        task();
+    }
+}
+
+ReadWorker::ReadWorker() {
+    /*
+        Start the worker thread
+    */
+
+    worker = std::thread(&ReadWorker::WorkerLoop, this);
+}
+
+ReadWorker::~ReadWorker() {
+    /*
+        Finish a running call and stop the worker thread
+    */
+
+    {
+        std::unique_lock<std::mutex> lock(slot_mutex);
+        slot_cond.wait(lock, [this] { return !pending; });
+        stop = true;
+    }
+    slot_cond.notify_all();
+    if (worker.joinable()) {
+        worker.join();
+    }
+}
+
+void ReadWorker::Start(const std::function<bool(int, uint8_t *)> &read, int eye_idx, uint8_t *out) {
+    /*
+        Place the read call in the task slot and wake the worker thread
+
+        params: read                    -- read function (eye index, output pointer); has to stay valid until Wait returns
+                int eye_idx             -- eye index passed to the read function
+                uint8_t *out            -- output pointer passed to the read function
+    */
+
+    {
+        std::lock_guard<std::mutex> lock(slot_mutex);
+        this->read = &read;
+        this->eye_idx = eye_idx;
+        this->out = out;
+        pending = true;
+    }
+    slot_cond.notify_all();
+}
+
+bool ReadWorker::Wait() {
+    /*
+        Wait for the started read call
+
+        return: bool                    -- result of the read function; False, if it threw an exception
+    */
+
+    std::unique_lock<std::mutex> lock(slot_mutex);
+    slot_cond.wait(lock, [this] { return !pending; });
+    return result;
+}
+
+void ReadWorker::WorkerLoop() {
+    /*
+        Run the started read calls until the worker is stopped
+    */
+
+    std::unique_lock<std::mutex> lock(slot_mutex);
+    while (true) {
+        slot_cond.wait(lock, [this] { return stop || (pending && read != nullptr); });
+        if (stop) {
+            return;
+        }
+        auto *call = read;
+        read = nullptr;
+        lock.unlock();
+        bool ok;
+        try {
+            ok = (*call)(eye_idx, out);
+        } catch (...) {
+            ok = false;
+        }
+        lock.lock();
+        result = ok;
+        pending = false;
+        slot_cond.notify_all();
+    }
+}
@@ -24,9 +24,11 @@
 #include <yarp/os/all.h>
 #include <yarp/sig/all.h>
 
+#include <algorithm>
 #include <chrono>
 #include <ctime>
 #include <iostream>
+#include <iterator>
 #include <opencv2/opencv.hpp>
 #include <queue>
 #include <string>
@@ -35,6 +37,7 @@
 
 #include "INI_Reader/INIReader.h"
 #include "Module_Base_Class.hpp"
+#include "Thread_Pool.hpp"
 #ifdef _USE_GRPC
 #include "ProvideInputServer.h"
 #endif
@@ -47,7 +50,7 @@ VisualReader::~VisualReader() { Close(); }
 // TODO(tofie): typing -> replace int with unsigned int, where it is useful
 // integer bilder übertragen?
 /*** public methods for the user ***/
-bool VisualReader::Init(char eye, double fov_width, double fov_height, int img_width, int img_height, bool fast_filter, std::string ini_path) {
+bool VisualReader::Init(char eye, double fov_width, double fov_height, int img_width, int img_height, bool fast_filter, std::string ini_path, std::string carrier) {
     /*
         Initialize Visual reader with given parameters for image resolution, field of view and eye selection
 
@@ -58,6 +61,7 @@ bool VisualReader::Init(char eye, double fov_width, double fov_height, int img_w
                 int img_width                   -- output image width in pixel (input width: 320px)
                 int img_height                  -- output image height in pixel (input height: 240px)
                 bool fast_filter                -- flag to select the filter for image upscaling; True for a faster filter
+                string carrier                  -- YARP carrier for the robot connections; empty: carrier option of the ini file
 
         return: bool                -- return True, if successful
     */
@@ -82,54 +86,38 @@ bool VisualReader::Init(char eye, double fov_width, double fov_height, int img_w
 #endif
 
         // compute output field of view borders in input image
-        if (fov_width <= icub_fov_x) {
-            out_fov_x_low = static_cast<int>(ceil(FovX2PixelX(-fov_width / 2.0)));
-            out_fov_x_up = static_cast<int>(floor(FovX2PixelX(fov_width / 2.0)));
-        } else {
+        if (fov_width > icub_fov_x) {
             std::cerr << "[Visual Reader] Selected field of view width is out of range" << std::endl;
             return false;
         }
-
-        if (fov_height <= icub_fov_y) {
-            out_fov_y_low = static_cast<int>(ceil(FovY2PixelY(fov_height / 2.0)));
-            out_fov_y_up = static_cast<int>(floor(FovY2PixelY(-fov_height / 2.0)));
-        } else {
+        if (fov_height > icub_fov_y) {
             std::cerr << "[Visual Reader] Selected field of view height is out of range" << std::endl;
             return false;
         }
+        cv::Rect out_rov = FovToRegionOfView(0., 0., fov_width, fov_height);
+        out_fov_x_low = out_rov.x;
+        out_fov_x_up = out_rov.x + out_rov.width;
+        out_fov_y_low = out_rov.y;
+        out_fov_y_up = out_rov.y + out_rov.height;
 
         // calculate output region of view (ROV) (image part equivalent to output field of view)
         rov_width = out_fov_x_up - out_fov_x_low;
         rov_height = out_fov_y_up - out_fov_y_low;
-        if (rov_width != fov_width || rov_height != fov_height) {
+        if (rov_width != icub_width || rov_height != icub_height) {
             cut_img = true;
         } else {
             cut_img = false;
         }
 
-        // set OpenCV type for use in method calls
-        if (typeid(precision) == typeid(double)) {
-            new_type = CV_64FC1;
-            std::cout << "[Visual Reader] Double precision is selected." << std::endl;
-        } else if (typeid(precision) == typeid(float)) {
-            new_type = CV_32FC1;
-            std::cout << "[Visual Reader] Single precision is selected." << std::endl;
-        } else {
-            std::cerr << "[Visual Reader] Precision type is not valid!" << std::endl;
-            return false;
-        }
-
         // calculate scaling factors to scale ROV to output image size
         res_scale_x = static_cast<double>(out_width) / (rov_width);
         res_scale_y = static_cast<double>(out_height) / (rov_height);
 
         // select filter for upscaling
-        if (res_scale_y > 1 || res_scale_x > 1) {
-            if (fast_filter) {
-                filter_ds = cv::INTER_LINEAR;
-            } else {
-                filter_ds = cv::INTER_CUBIC;
-            }
+        if (fast_filter) {
+            filter_ds = cv::INTER_LINEAR;
+        } else {
+            filter_ds = cv::INTER_CUBIC;
         }
 
         norm_fact = 1 / 255.0;
@@ -147,91 +135,132 @@ bool VisualReader::Init(char eye, double fov_width, double fov_height, int img_w
         }
         client_port_prefix = reader_gen.Get("general", "client_port_prefix", "/client");
 
+        // carrier of the camera connections; [vision] or [general] ini option, if the argument is empty
+        std::string port_carrier = carrier.empty() ? reader_gen.Get("vision", "carrier", reader_gen.Get("general", "carrier", "")) : carrier;
+
+        // select the output element type; the conversion is part of the image processing
+        std::string dtype_name = reader_gen.Get("vision", "dtype", "float64");
+        if (!ParseImageDType(dtype_name, out_dtype)) {
+            std::cerr << "[Visual Reader] Output type \"" << dtype_name << "\" is not valid! Valid types: uint8, float16, float32, float64" << std::endl;
+            return false;
+        }
+        out_elem_size = ImageDTypeSize(out_dtype);
+        std::cout << "[Visual Reader] Output type " << dtype_name << " is selected." << std::endl;
+        init_param["dtype"] = dtype_name;
+
         bool gray = reader_gen.GetBoolean("vision", "gray", true);
         if (gray) {
             colorcode = cv::COLOR_RGB2GRAY;
+            out_channels = 1;
         } else {
             colorcode = cv::COLOR_RGB2BGR;
+            out_channels = 3;
         }
 
-        // open and connect YARP port for the chosen eye
-        if (eye == 'r' || eye == 'R') {    // right eye chosen
-            act_eye = 'R';
-            std::string port_name = client_port_prefix + "/V_Reader/image_" + eye + "_" + std::to_string(std::time(NULL)) + "/right:i";
-
-            std::string robot_port_calib = robot_port_prefix + "/camcalib/right/out";
-            robot_port_name_r = robot_port_prefix + "/cam/right";
-            std::string robot_port_postfix = "/rgbImage:o";
+        // select the sampling layout: cartesian image with the given size or log-polar retina
+        bool log_polar = reader_gen.GetBoolean("vision", "log_polar", false);
+        int rings = reader_gen.GetInteger("vision", "log_polar_rings", 32);
+        int wedges = reader_gen.GetInteger("vision", "log_polar_wedges", 64);
+        double fovea_radius = reader_gen.GetReal("vision", "log_polar_fovea", 8.);
+
+        // precompute the resampling/remap tables for the selected region of view and output size; one processor per eye to process both eyes in parallel
+        cv::Rect rov(out_fov_x_low, out_fov_y_low, rov_width, rov_height);
+        for (auto &proc : processor) {
+            bool proc_init;
+            if (log_polar) {
+                proc_init = proc.InitLogPolar(icub_width, icub_height, rov, rings, wedges, fovea_radius, gray);
+            } else {
+                proc_init = proc.Init(icub_width, icub_height, rov, out_width, out_height, gray, filter_ds);
+            }
+            if (!proc_init) {
+                std::cerr << "[Visual Reader] Image preprocessing could not be initialized!" << std::endl;
+                return false;
+            }
+        }
 
-            if (yarp::os::Network::exists(robot_port_calib)) {
-                robot_port_name_r = robot_port_calib;
-            } else if (yarp::os::Network::exists(robot_port_name_r + robot_port_postfix)) {
-                robot_port_name_r = robot_port_name_r + robot_port_postfix;
+        // lens undistortion, fused with the crop and scaling into one remap table per eye
+        if (reader_gen.GetBoolean("vision", "undistort", false)) {
+            std::string calib_file = reader_gen.Get("vision", "calibration_file", "");
+            const std::string sides[2] = {"right", "left"};
+            for (int i = 0; i < 2; i++) {
+                std::vector<double> intrinsics, distortion;
+                if (!calib_file.empty()) {
+                    if (!LoadCameraCalibration(calib_file, i, intrinsics, distortion)) {
+                        return false;
+                    }
+                } else {
+                    std::string section = "camera_calibration_" + sides[i];
+                    double calib_width = reader_gen.GetReal(section, "w", icub_width);
+                    double calib_height = reader_gen.GetReal(section, "h", icub_height);
+                    intrinsics = {reader_gen.GetReal(section, "fx", 0.) * icub_width / calib_width, reader_gen.GetReal(section, "fy", 0.) * icub_height / calib_height,
+                                  reader_gen.GetReal(section, "cx", 0.) * icub_width / calib_width, reader_gen.GetReal(section, "cy", 0.) * icub_height / calib_height};
+                    distortion = {reader_gen.GetReal(section, "k1", 0.), reader_gen.GetReal(section, "k2", 0.), reader_gen.GetReal(section, "p1", 0.),
+                                  reader_gen.GetReal(section, "p2", 0.), reader_gen.GetReal(section, "k3", 0.)};
+                }
+                if (!processor[i].SetUndistortion(intrinsics, distortion)) {
+                    std::cerr << "[Visual Reader] Invalid camera calibration for the " << sides[i] << " eye!" << std::endl;
+                    return false;
+                }
             }
+            init_param["undistort"] = calib_file.empty() ? "ini" : calib_file;
+        }
+        if (log_polar) {
+            // the retina replaces the cartesian output image: rings x wedges
+            out_width = wedges;
+            out_height = rings;
+            init_param["log_polar_rings"] = std::to_string(rings);
+            init_param["log_polar_wedges"] = std::to_string(wedges);
+            init_param["log_polar_fovea"] = std::to_string(fovea_radius);
+        }
+        out_size = static_cast<size_t>(out_width) * out_height * out_channels;
+
+        // configured copies of the processors; SetRegionOfView computes the tables of the next region of view on them
+        for (size_t i = 0; i < std::size(processor); i++) {
+            pending_processor[i] = processor[i];
+            rov_pending[i] = false;
+        }
 
-            port_right.open(port_name);
-            if (!yarp::os::Network::connect(robot_port_name_r.c_str(), port_name.c_str())) {
+        // image pyramid with the processed image as single level, until SetPyramidLevels is called
+        pyramid_shapes = {out_height, out_width};
+        pyramid_level_offsets = {0};
+        pyramid_size = out_size;
+
+        // subscribe to the shared camera source(s) of the chosen eye; readers of the same camera share one port
+        if (eye == 'r' || eye == 'R') {    // right eye chosen
+            act_eye = 'R';
+            robot_port_name_r = ResolveCameraPort("right");
+            camera[0] = CameraSource::Subscribe(robot_port_name_r, client_port_prefix, port_carrier);
+            if (!camera[0]) {
                 std::cerr << "[Visual Reader] Could not connect to right eye camera port!" << std::endl;
                 return false;
             }
         } else if (eye == 'l' || eye == 'L') {    // left eye chosen
             act_eye = 'L';
-            std::string port_name = client_port_prefix + "/V_Reader/image_" + eye + "_" + std::to_string(std::time(NULL)) + "/left:i";
-
-            std::string robot_port_calib = robot_port_prefix + "/camcalib/left/out";
-            robot_port_name_l = robot_port_prefix + "/cam/left";
-            std::string robot_port_postfix = "/rgbImage:o";
-
-            if (yarp::os::Network::exists(robot_port_calib)) {
-                robot_port_name_l = robot_port_calib;
-            } else if (yarp::os::Network::exists(robot_port_name_l + robot_port_postfix)) {
-                robot_port_name_l = robot_port_name_l + robot_port_postfix;
-            }
-
-            port_left.open(port_name);
-            if (!yarp::os::Network::connect(robot_port_name_l.c_str(), port_name.c_str())) {
+            robot_port_name_l = ResolveCameraPort("left");
+            camera[1] = CameraSource::Subscribe(robot_port_name_l, client_port_prefix, port_carrier);
+            if (!camera[1]) {
                 std::cerr << "[Visual Reader] Could not connect to left eye camera port!" << std::endl;
                 return false;
             }
         } else if (eye == 'b' || eye == 'B') {    // both eyes chosen
             act_eye = 'B';
-            // left eye
-            std::string port_name_l = client_port_prefix + "/V_Reader/image_" + eye + "_" + std::to_string(std::time(NULL)) + "/left:i";
-
-            std::string robot_port_calib_l = robot_port_prefix + "/camcalib/left/out";
-            robot_port_name_l = robot_port_prefix + "/cam/left";
-            std::string robot_port_postfix_l = "/rgbImage:o";
-
-            if (yarp::os::Network::exists(robot_port_calib_l)) {
-                robot_port_name_l = robot_port_calib_l;
-            } else if (yarp::os::Network::exists(robot_port_name_l + robot_port_postfix_l)) {
-                robot_port_name_l = robot_port_name_l + robot_port_postfix_l;
-            }
-
-            port_left.open(port_name_l);
-            if (!yarp::os::Network::connect(robot_port_name_l.c_str(), port_name_l.c_str())) {
+            robot_port_name_l = ResolveCameraPort("left");
+            camera[1] = CameraSource::Subscribe(robot_port_name_l, client_port_prefix, port_carrier);
+            if (!camera[1]) {
                 std::cerr << "[Visual Reader] Could not connect to left eye camera port!" << std::endl;
                 return false;
             }
 
-            // right eye
-            std::string port_name_r = client_port_prefix + "/V_Reader/image_" + eye + "_" + std::to_string(std::time(NULL)) + "/right:i";
-
-            std::string robot_port_calib_r = robot_port_prefix + "/camcalib/right/out";
-            std::string robot_port_name_r = robot_port_prefix + "/cam/right";
-            std::string robot_port_postfix_r = "/rgbImage:o";
-
-            if (yarp::os::Network::exists(robot_port_calib_r)) {
-                robot_port_name_r = robot_port_calib_r;
-            } else if (yarp::os::Network::exists(robot_port_name_r + robot_port_postfix_r)) {
-                robot_port_name_r = robot_port_name_r + robot_port_postfix_r;
-            }
-
-            port_right.open(port_name_r);
-            if (!yarp::os::Network::connect(robot_port_name_r.c_str(), port_name_r.c_str())) {
+            robot_port_name_r = ResolveCameraPort("right");
+            camera[0] = CameraSource::Subscribe(robot_port_name_r, client_port_prefix, port_carrier);
+            if (!camera[0]) {
+                camera[1].reset();
                 std::cerr << "[Visual Reader] Could not connect to right eye camera port!" << std::endl;
                 return false;
             }
+
+            // persistent worker for the right eye, the left eye is handled by the calling thread
+            eye_worker = std::make_unique<ReadWorker>();
         } else {
             std::cerr << "[Visual Reader] Invalid character for eye selection!" << std::endl;
             return false;
@@ -246,6 +275,7 @@ bool VisualReader::Init(char eye, double fov_width, double fov_height, int img_w
         init_param["img_height"] = std::to_string(img_height);
         init_param["fast_filter"] = std::to_string(fast_filter);
         init_param["ini_path"] = ini_path;
+        init_param["carrier"] = carrier;
         this->dev_init = true;
         return true;
     } else {
@@ -255,7 +285,7 @@ bool VisualReader::Init(char eye, double fov_width, double fov_height, int img_w
 }
 
 #ifdef _USE_GRPC
-bool VisualReader::InitGRPC(char eye, double fov_width, double fov_height, int img_width, int img_height, bool fast_filter, std::string ini_path, std::string ip_address, unsigned int port) {
+bool VisualReader::InitGRPC(char eye, double fov_width, double fov_height, int img_width, int img_height, bool fast_filter, std::string ini_path, std::string ip_address, unsigned int port, std::string carrier) {
     /*
         Initialize Visual reader with given parameters for image resolution, field of view, eye selection and grpc parameter
 
@@ -268,12 +298,13 @@ bool VisualReader::InitGRPC(char eye, double fov_width, double fov_height, int i
                 bool fast_filter                -- flag to select the filter for image upscaling; True for a faster filter
                 string ip_address               -- gRPC server ip address
                 unsigned int port               -- gRPC server port
+                string carrier                  -- YARP carrier for the robot connections; empty: carrier option of the ini file
 
         return: bool                -- return True, if successful
     */
 
     if (!this->dev_init) {
-        if (this->Init(eye, fov_width, fov_height, img_width, img_height, fast_filter, ini_path)) {
+        if (this->Init(eye, fov_width, fov_height, img_width, img_height, fast_filter, ini_path, carrier)) {
             this->_ip_address = ip_address;
             this->_port = port;
             this->image_source = new ServerInstance(ip_address, port, this);
@@ -292,7 +323,7 @@ bool VisualReader::InitGRPC(char eye, double fov_width, double fov_height, int i
     }
 }
 #else
-bool VisualReader::InitGRPC(char eye, double fov_width, double fov_height, int img_width, int img_height, bool fast_filter, std::string ini_path, std::string ip_address, unsigned int port) {
+bool VisualReader::InitGRPC(char eye, double fov_width, double fov_height, int img_width, int img_height, bool fast_filter, std::string ini_path, std::string ip_address, unsigned int port, std::string carrier) {
     /*
         Initialize Visual reader with given parameters for image resolution, field of view, eye selection and grpc parameter
 
@@ -305,6 +336,7 @@ bool VisualReader::InitGRPC(char eye, double fov_width, double fov_height, int i
                 bool fast_filter                -- flag to select the filter for image upscaling; True for a faster filter
                 string ip_address               -- gRPC server ip address
                 unsigned int port               -- gRPC server port
+                string carrier                  -- YARP carrier for the robot connections; empty: carrier option of the ini file
 
         return: bool                -- return True, if successful
     */
@@ -313,116 +345,612 @@ bool VisualReader::InitGRPC(char eye, double fov_width, double fov_height, int i
 }
 #endif
 
-std::vector<std::vector<VisualReader::precision>> VisualReader::ReadRobotEyes() {
-    std::vector<std::vector<VisualReader::precision>> imgs;
+std::vector<std::vector<double>> VisualReader::ReadRobotEyes() {
+    std::vector<std::vector<double>> imgs;
     if (CheckInit()) {
-        switch (act_eye) {
-            case 'B':
-                // read image from the iCub and get CV-Matrix
-                iEyeRgb_r = port_left.read();
-                iEyeRgb_r = port_left.read();
-                // yarp::os::Time::delay(0.005);
-                iEyeRgb_l = port_right.read();
-                iEyeRgb_l = port_right.read();
-                // yarp::os::Time::delay(0.005);
-
-                if (iEyeRgb_r == nullptr || iEyeRgb_l == nullptr) {
-                    return imgs;
-                }
+        auto shape = GetOutputShape();
+        std::vector<uint8_t> buffer(shape[0] * out_size * out_elem_size);
+        if (ReadRobotEyesBuffer(buffer.data(), shape[0] * out_size)) {
+            for (int i = 0; i < shape[0]; i++) {
+                cv::Mat img(1, static_cast<int>(out_size), CV_MAKETYPE(ImageDTypeDepth(out_dtype), 1), buffer.data() + i * out_size * out_elem_size);
+                std::vector<double> vec(out_size);
+                cv::Mat vec_mat(1, static_cast<int>(out_size), CV_64FC1, vec.data());
+                img.convertTo(vec_mat, CV_64F);
+                imgs.push_back(std::move(vec));
+            }
+        }
+    }
+    return imgs;
+}
 
-                // convert image to RGB or Gray
-                cv::cvtColor(yarp::cv::toCvMat(*iEyeRgb_r), tmpMat_r, colorcode);
-                cv::cvtColor(yarp::cv::toCvMat(*iEyeRgb_l), tmpMat_l, colorcode);
+bool VisualReader::ReadRobotEyesBuffer(void *buffer, size_t size) {
+    /*
+        Read a set of images from the robot cameras and write the preprocessed images directly into the given buffer
 
-                // extracting the output part of the field of view
-                if (!cut_img) {
-                    ROV_r = tmpMat_r;
-                    ROV_l = tmpMat_l;
-                } else {
-                    ROV_r = tmpMat_r(cv::Rect(out_fov_x_low, out_fov_y_low, rov_width, rov_height)).clone();
-                    ROV_l = tmpMat_l(cv::Rect(out_fov_x_low, out_fov_y_low, rov_width, rov_height)).clone();
-                }
+        params: void *buffer            -- caller owned buffer for the flattened images; elements of the output type
+                size_t size             -- number of elements in the buffer
+
+        return: bool                    -- return True, if successful
+    */
+
+    if (CheckInit()) {
+        auto shape = GetOutputShape();
+        if (size != shape[0] * out_size) {
+            std::cerr << "[Visual Reader] Buffer size " << size << " does not match the output size " << shape[0] * out_size << "!" << std::endl;
+            return false;
+        }
 
-                // resize ROV to given output resolution
-                if (res_scale_x == 1 && res_scale_x == 1) {
-                    monoMat_r = ROV_r;
-                    monoMat_l = ROV_l;
+        return ReadEyes([this](int eye_idx, uint8_t *out) { return ReadEye(eye_idx, out, out_dtype); }, static_cast<uint8_t *>(buffer),
+                        out_size * out_elem_size);
+    }
+    return false;
+}
 
-                } else if (res_scale_x < 1 || res_scale_x < 1) {
-                    cv::resize(ROV_r, monoMat_r, cv::Size(), res_scale_x, res_scale_y, cv::INTER_AREA);
-                    cv::resize(ROV_l, monoMat_l, cv::Size(), res_scale_x, res_scale_y, cv::INTER_AREA);
+int VisualReader::GetOutputType() {
+    /*
+        Return the element type of the processed camera images
 
-                } else {
-                    cv::resize(ROV_r, monoMat_r, cv::Size(), res_scale_x, res_scale_y, filter_ds);
-                    cv::resize(ROV_l, monoMat_l, cv::Size(), res_scale_x, res_scale_y, filter_ds);
-                }
+        return: int                     -- 0: uint8; 1: float16; 2: float32; 3: float64
+    */
 
-                // normalize the image from 0..255 to 0..1.0
-                monoMat_r.convertTo(tmpMat1_r, new_type, norm_fact);
-                monoMat_l.convertTo(tmpMat1_l, new_type, norm_fact);
+    if (CheckInit()) {
+        return static_cast<int>(out_dtype);
+    }
+    return -1;
+}
 
-                // flat the image matrix to 1D-vector
-                // store image in the buffer
-                imgs.push_back(MatC2Vec(tmpMat1_r));
-                imgs.push_back(MatC2Vec(tmpMat1_l));
-                break;
+bool VisualReader::SetPyramidLevels(int levels) {
+    /*
+        Set the number of pyramid levels for ReadRobotEyesPyramid and compute the level sizes and buffer offsets
 
-            case 'L':
-                iEyeRgb = port_left.read();
-                iEyeRgb = port_left.read();
-                // yarp::os::Time::delay(0.005);
-                if (iEyeRgb == nullptr) {
-                    return imgs;
-                }
-                imgs.push_back(ProcessRead());
-                break;
+        params: int levels              -- number of pyramid levels; level 0 is the processed image, each further level halves the size
 
-            case 'R':
-                iEyeRgb = port_right.read();
-                iEyeRgb = port_right.read();
-                // yarp::os::Time::delay(0.005);
-                if (iEyeRgb == nullptr) {
-                    return imgs;
+        return: bool                    -- return True, if successful
+    */
+
+    if (CheckInit()) {
+        if (levels < 1) {
+            std::cerr << "[Visual Reader] The pyramid needs at least one level!" << std::endl;
+            return false;
+        }
+
+        auto shape = processor[0].GetOutputShape();
+        int height = shape[0];
+        int width = shape[1];
+        pyramid_shapes.clear();
+        pyramid_level_offsets.clear();
+        size_t offset = 0;
+        for (int l = 0; l < levels; l++) {
+            if (l > 0) {
+                // same size rule as cv::pyrDown
+                height = (height + 1) / 2;
+                width = (width + 1) / 2;
+            }
+            pyramid_shapes.push_back(height);
+            pyramid_shapes.push_back(width);
+            pyramid_level_offsets.push_back(offset);
+            offset += static_cast<size_t>(height) * width * out_channels;
+        }
+        pyramid_size = offset;
+        return true;
+    }
+    return false;
+}
+
+std::vector<size_t> VisualReader::GetPyramidOffsets() {
+    /*
+        Return the start offsets of the pyramid levels in the buffer of ReadRobotEyesPyramid
+
+        return: std::vector<size_t>     -- offsets per image and level (image major) and the total buffer size as last entry
+    */
+
+    std::vector<size_t> offsets;
+    if (CheckInit()) {
+        int n_images = GetOutputShape()[0];
+        for (int img = 0; img < n_images; img++) {
+            for (auto level_offset : pyramid_level_offsets) {
+                offsets.push_back(img * pyramid_size + level_offset);
+            }
+        }
+        offsets.push_back(n_images * pyramid_size);
+    }
+    return offsets;
+}
+
+std::vector<int> VisualReader::GetPyramidShapes() {
+    /*
+        Return the image size of the pyramid levels
+
+        return: std::vector<int>        -- height and width of each level (level major)
+    */
+
+    if (CheckInit()) {
+        return pyramid_shapes;
+    }
+    return std::vector<int>();
+}
+
+bool VisualReader::ReadRobotEyesPyramid(void *buffer, size_t size) {
+    /*
+        Read a set of images and write the image pyramids into the given buffer; the levels are computed from the respective previous level
+
+        params: void *buffer            -- caller owned buffer for the pyramid levels; elements of the output type
+                size_t size             -- number of elements in the buffer
+
+        return: bool                    -- return True, if successful
+    */
+
+    if (CheckInit()) {
+        size_t total_size = GetOutputShape()[0] * pyramid_size;
+        if (size != total_size) {
+            std::cerr << "[Visual Reader] Buffer size " << size << " does not match the pyramid size " << total_size << "!" << std::endl;
+            return false;
+        }
+
+        return ReadEyes(
+            [this](int eye_idx, uint8_t *out) {
+                if (!ReadEye(eye_idx, out, out_dtype)) {
+                    return false;
                 }
-                imgs.push_back(ProcessRead());
-                break;
+                BuildPyramid(out);
+                return true;
+            },
+            static_cast<uint8_t *>(buffer), pyramid_size * out_elem_size);
+    }
+    return false;
+}
 
-            default:
-                return imgs;
-                break;
+std::vector<int> VisualReader::GetOutputShape() {
+    /*
+        Return the shape of the processed camera images
+
+        return: std::vector<int>        -- number of images and number of elements per flattened image
+    */
+
+    std::vector<int> shape(2, 0);
+    if (CheckInit()) {
+        shape[0] = (act_eye == 'B') ? 2 : 1;
+        shape[1] = static_cast<int>(out_size);
+    }
+    return shape;
+}
+
+std::vector<int> VisualReader::GetImageShape() {
+    /*
+        Return the shape of a single processed camera image
+
+        return: std::vector<int>        -- image height, width and channel count; for the log-polar layout: rings, wedges and channel count
+    */
+
+    std::vector<int> shape(3, 0);
+    if (CheckInit()) {
+        shape = processor[0].GetOutputShape();
+    }
+    return shape;
+}
+
+int VisualReader::GetImageLayout() {
+    /*
+        Return the sampling layout of the processed camera images
+
+        return: int                     -- 0: cartesian; 1: log-polar
+    */
+
+    if (CheckInit()) {
+        return static_cast<int>(processor[0].GetLayout());
+    }
+    return -1;
+}
+
+bool VisualReader::SetRegionOfView(double center_x, double center_y, double fov_width, double fov_height) {
+    /*
+        Move the region of view without reinitialization; the resampling tables are computed for the pending processors and swapped in
+        by the next read of each eye -> no table is changed while a read uses it
+
+        params: double center_x         -- horizontal center of the region of view in degree (positive: right)
+                double center_y         -- vertical center of the region of view in degree (positive: up)
+                double fov_width        -- field of view width in degree
+                double fov_height       -- field of view height in degree
+
+        return: bool                    -- return True, if successful
+    */
+
+    if (CheckInit()) {
+        if (fov_width <= 0. || std::abs(center_x) + fov_width / 2. > icub_fov_x / 2.) {
+            std::cerr << "[Visual Reader] Selected region of view exceeds the horizontal field of view!" << std::endl;
+            return false;
+        }
+        if (fov_height <= 0. || std::abs(center_y) + fov_height / 2. > icub_fov_y / 2.) {
+            std::cerr << "[Visual Reader] Selected region of view exceeds the vertical field of view!" << std::endl;
+            return false;
         }
 
-        return imgs;
+        // pixel borders in the input image, computed like in Init
+        cv::Rect rov = FovToRegionOfView(center_x, center_y, fov_width, fov_height);
+
+        // a processor keeps its previous tables if the geometry is invalid -> restore the already updated pending processors,
+        // both eyes keep the same region of view
+        std::lock_guard<std::mutex> lock(rov_mutex);
+        cv::Rect prev_rov(out_fov_x_low, out_fov_y_low, rov_width, rov_height);
+        for (size_t i = 0; i < std::size(pending_processor); i++) {
+            if (!pending_processor[i].SetRegionOfView(rov)) {
+                std::cerr << "[Visual Reader] Region of view could not be set!" << std::endl;
+                for (size_t j = 0; j < i; j++) {
+                    pending_processor[j].SetRegionOfView(prev_rov);
+                }
+                return false;
+            }
+        }
+        for (auto &pending : rov_pending) {
+            pending = true;
+        }
+
+        out_fov_x_low = rov.x;
+        out_fov_x_up = rov.x + rov.width;
+        out_fov_y_low = rov.y;
+        out_fov_y_up = rov.y + rov.height;
+        rov_width = rov.width;
+        rov_height = rov.height;
+        cut_img = (rov_width != icub_width || rov_height != icub_height);
+        res_scale_x = static_cast<double>(out_width) / (rov_width);
+        res_scale_y = static_cast<double>(out_height) / (rov_height);
+
+        // the event reference belongs to the previous region of view
+        event_ref_valid = false;
+        // runtime state -> the init parameters for saving the robot stay unchanged
+        return true;
     }
+    return false;
 }
 
 std::vector<uint8_t> VisualReader::RetrieveRobotEye() {
-    std::vector<uint8_t> img;
     if (CheckInit()) {
-        // read image from the iCub and get CV-Matrix
+        // read image from the iCub
+        const yarp::sig::ImageOf<yarp::sig::PixelRgb> *img;
         switch (act_eye) {
             case 'L':
-                iEyeRgb = port_left.read();
-                iEyeRgb = port_left.read();
-                // yarp::os::Time::delay(0.005);
+                img = AcquireImage(1);
                 break;
             case 'R':
-                iEyeRgb = port_right.read();
-                iEyeRgb = port_right.read();
-                // yarp::os::Time::delay(0.005);
+                img = AcquireImage(0);
                 break;
             default:
                 return std::vector<uint8_t>();
                 break;
         }
+        if (img == nullptr) {
+            return std::vector<uint8_t>();
+        }
 
         // convert yarp image to vector
-        std::vector<uint8_t> vec(iEyeRgb->getRawImage(), iEyeRgb->getRawImage() + iEyeRgb->getRawImageSize());
+        std::vector<uint8_t> vec(img->getRawImage(), img->getRawImage() + img->getRawImageSize());
         return vec;
     }
     return std::vector<uint8_t>();
 }
 
+bool VisualReader::SetCaptureMode(bool threaded) {
+    /*
+        Select the capture mode -> newest frame of the camera source or wait for the next frame
+
+        params: bool threaded           -- True to return the newest frame
+
+        return: bool                    -- return True, if successful
+    */
+
+    if (CheckInit()) {
+        // the camera sources receive the frames in the background anyway, the mode selects only the frame handed out by AcquireImage
+        capture_threaded = threaded;
+        return true;
+    }
+    return false;
+}
+
+std::vector<unsigned long long> VisualReader::GetFrameSequence() {
+    /*
+        Return the sequence numbers of the images returned by the last read call
+
+        return: std::vector<unsigned long long>     -- frame sequence numbers
+    */
+
+    std::vector<unsigned long long> seq;
+    if (CheckInit()) {
+        if (act_eye == 'R' || act_eye == 'B') seq.push_back(last_frame[0] ? last_frame[0]->sequence : 0);
+        if (act_eye == 'L' || act_eye == 'B') seq.push_back(last_frame[1] ? last_frame[1]->sequence : 0);
+    }
+    return seq;
+}
+
+std::vector<double> VisualReader::GetFrameTimestamp() {
+    /*
+        Return the timestamps of the images returned by the last read call
+
+        return: std::vector<double>     -- frame timestamps in seconds
+    */
+
+    std::vector<double> stamps;
+    if (CheckInit()) {
+        if (act_eye == 'R' || act_eye == 'B') stamps.push_back(last_frame[0] ? last_frame[0]->timestamp : 0.);
+        if (act_eye == 'L' || act_eye == 'B') stamps.push_back(last_frame[1] ? last_frame[1]->timestamp : 0.);
+    }
+    return stamps;
+}
+
+bool VisualReader::SetEventThreshold(double threshold) {
+    /*
+        Set the contrast threshold for the event output and reset the event reference frame
+
+        params: double threshold        -- minimal change of the log-intensity, which triggers an event
+
+        return: bool                    -- return True, if successful
+    */
+
+    if (CheckInit()) {
+        if (threshold <= 0.) {
+            std::cerr << "[Visual Reader] Event threshold has to be positive!" << std::endl;
+            return false;
+        }
+        event_threshold = threshold;
+        event_ref_valid = false;
+        return true;
+    }
+    return false;
+}
+
+bool VisualReader::ReadRobotEyesEvents(std::vector<int> &index, std::vector<int8_t> &polarity, std::vector<double> &timestamp) {
+    /*
+        Read a set of images and return the pixels, whose log-intensity changed by more than the event threshold since their last event
+
+        params: std::vector<int> &index             -- flattened pixel indices of the events
+                std::vector<int8_t> &polarity       -- event polarities; 1: brighter, -1: darker
+                std::vector<double> &timestamp      -- frame timestamps of the events in seconds
+
+        return: bool                                -- return True, if successful
+    */
+
+    index.clear();
+    polarity.clear();
+    timestamp.clear();
+    if (CheckInit()) {
+        auto shape = GetOutputShape();
+        size_t total_size = shape[0] * out_size;
+        // the events are computed on normalized single precision images, independent of the output type
+        event_frame.resize(total_size);
+        if (!ReadEyes([this](int eye_idx, uint8_t *out) { return ReadEye(eye_idx, out, ImageDType::FLOAT32); },
+                      reinterpret_cast<uint8_t *>(event_frame.data()), out_size * sizeof(float))) {
+            return false;
+        }
+
+        // the first frame only sets the reference
+        if (!event_ref_valid || event_ref.size() != total_size) {
+            event_ref.resize(total_size);
+            for (size_t i = 0; i < total_size; i++) {
+                event_ref[i] = std::log(event_eps + event_frame[i]);
+            }
+            event_ref_valid = true;
+            return true;
+        }
+
+        // compare with the log-intensity at the last event of each pixel; the reference is only updated for pixels emitting an event
+        auto stamps = GetFrameTimestamp();
+        const float threshold = static_cast<float>(event_threshold);
+        for (int img = 0; img < shape[0]; img++) {
+            for (size_t i = img * out_size; i < (img + 1) * out_size; i++) {
+                float log_intensity = std::log(event_eps + event_frame[i]);
+                float diff = log_intensity - event_ref[i];
+                if (diff > threshold || diff < -threshold) {
+                    index.push_back(static_cast<int>(i));
+                    polarity.push_back((diff > 0.f) ? 1 : -1);
+                    timestamp.push_back(stamps[img]);
+                    event_ref[i] = log_intensity;
+                }
+            }
+        }
+        return true;
+    }
+    return false;
+}
+
+bool VisualReader::SetDisparity(int method, int num_disparities, int block_size) {
+    /*
+        Select the stereo matcher for the disparity output; the camera images are assumed to be rectified
+
+        params: int method              -- matching algorithm; 0: block matching, 1: semi-global block matching
+                int num_disparities     -- disparity search range in output pixels (positive multiple of 16)
+                int block_size          -- size of the matched blocks in output pixels (odd)
+
+        return: bool                    -- return True, if successful
+    */
+
+    if (CheckInit()) {
+        if (act_eye != 'B') {
+            std::cerr << "[Visual Reader] The disparity output is only available in binocular mode!" << std::endl;
+            return false;
+        }
+        if (processor[0].GetLayout() != ImageLayout::CARTESIAN) {
+            std::cerr << "[Visual Reader] The disparity output is only available for the cartesian layout!" << std::endl;
+            return false;
+        }
+        if (num_disparities <= 0 || num_disparities % 16 != 0 || num_disparities >= out_width) {
+            std::cerr << "[Visual Reader] Number of disparities has to be a positive multiple of 16 and smaller than the output width!" << std::endl;
+            return false;
+        }
+        if (block_size % 2 == 0 || block_size < 1 || block_size > std::min(out_width, out_height)) {
+            std::cerr << "[Visual Reader] Block size has to be odd and fit into the output image!" << std::endl;
+            return false;
+        }
+
+        switch (method) {
+            case 0:
+                if (block_size < 5 || block_size > 255) {
+                    std::cerr << "[Visual Reader] Block size for block matching has to be in [5, 255]!" << std::endl;
+                    return false;
+                }
+                stereo_matcher = cv::StereoBM::create(num_disparities, block_size);
+                break;
+
+            case 1: {
+                // smoothness penalties for single channel images as recommended by OpenCV
+                int area = block_size * block_size;
+                stereo_matcher = cv::StereoSGBM::create(0, num_disparities, block_size, 8 * area, 32 * area, 1, 63, 10, 100, 2);
+                break;
+            }
+
+            default:
+                std::cerr << "[Visual Reader] Invalid stereo matching method! Valid methods: 0 (block matching), 1 (semi-global block matching)" << std::endl;
+                return false;
+        }
+        return true;
+    }
+    return false;
+}
+
+bool VisualReader::ReadRobotEyesDisparity(void *buffer, size_t size, float *disparity, size_t disparity_size) {
+    /*
+        Read a set of images and compute the disparity map of the image pair at the output resolution; the left eye is the reference
+
+        params: void *buffer            -- caller owned buffer for the flattened images (right, left); elements of the output type
+                size_t size             -- number of elements in the image buffer
+                float *disparity        -- caller owned buffer for the disparity map in output pixels; -1 for pixels without valid match
+                size_t disparity_size   -- number of elements in the disparity buffer
+
+        return: bool                    -- return True, if successful
+    */
+
+    if (CheckInit()) {
+        if (!stereo_matcher) {
+            std::cerr << "[Visual Reader] No stereo matcher is selected! Call SetDisparity first." << std::endl;
+            return false;
+        }
+        if (size != 2 * out_size) {
+            std::cerr << "[Visual Reader] Buffer size " << size << " does not match the output size " << 2 * out_size << "!" << std::endl;
+            return false;
+        }
+        size_t disparity_total = static_cast<size_t>(out_width) * out_height;
+        if (disparity_size != disparity_total) {
+            std::cerr << "[Visual Reader] Disparity buffer size " << disparity_size << " does not match the image size " << disparity_total << "!" << std::endl;
+            return false;
+        }
+
+        // the matcher input is prepared per eye, thus in parallel for both eyes
+        if (!ReadEyes(
+                [this](int eye_idx, uint8_t *out) {
+                    if (!ReadEye(eye_idx, out, out_dtype)) {
+                        return false;
+                    }
+                    StereoInput(eye_idx, out);
+                    return true;
+                },
+                static_cast<uint8_t *>(buffer), out_size * out_elem_size)) {
+            return false;
+        }
+
+        // fixed-point result with 4 fractional bits; unmatched pixels are marked with (min. disparity - 1) * 16 -> -1 after scaling
+        stereo_matcher->compute(stereo_gray[1], stereo_gray[0], stereo_raw);
+        cv::Mat disparity_map(out_height, out_width, CV_32FC1, disparity);
+        stereo_raw.convertTo(disparity_map, CV_32F, 1. / 16.);
+        return true;
+    }
+    return false;
+}
+
+bool VisualReader::SetGaborFilters(int orientations, std::vector<double> wavelengths, std::vector<double> phases) {
+    /*
+        Select a bank of oriented Gabor filters as output stage
+
+        params: int orientations                -- number of orientations in [0°, 180°)
+                std::vector<double> wavelengths -- carrier wavelengths in output pixels
+                std::vector<double> phases      -- carrier phase offsets in degree
+
+        return: bool                            -- return True, if successful
+    */
+
+    if (CheckInit()) {
+        if (!PrepareFilterBank()) {
+            return false;
+        }
+        for (auto &bank : filter_bank) {
+            if (!bank.InitGabor(orientations, wavelengths, phases)) {
+                std::cerr << "[Visual Reader] Invalid Gabor filter parameters! At least one orientation, wavelength (>= 2 pixel) and phase are needed." << std::endl;
+                filter_bank[0].Clear();
+                filter_bank[1].Clear();
+                return false;
+            }
+        }
+        return true;
+    }
+    return false;
+}
+
+bool VisualReader::SetDoGFilters(std::vector<double> sigmas, double surround_ratio) {
+    /*
+        Select a bank of ON/OFF difference-of-Gaussians as output stage
+
+        params: std::vector<double> sigmas      -- center standard deviations in output pixels
+                double surround_ratio           -- ratio of surround and center standard deviation
+
+        return: bool                            -- return True, if successful
+    */
+
+    if (CheckInit()) {
+        if (!PrepareFilterBank()) {
+            return false;
+        }
+        for (auto &bank : filter_bank) {
+            if (!bank.InitDoG(sigmas, surround_ratio)) {
+                std::cerr << "[Visual Reader] Invalid DoG filter parameters! At least one positive sigma and a surround ratio > 1 are needed." << std::endl;
+                filter_bank[0].Clear();
+                filter_bank[1].Clear();
+                return false;
+            }
+        }
+        return true;
+    }
+    return false;
+}
+
+std::vector<int> VisualReader::GetFilterShape() {
+    /*
+        Return the shape of the filter responses of a single image
+
+        return: std::vector<int>        -- number of filter maps, image height and image width
+    */
+
+    std::vector<int> shape(3, 0);
+    if (CheckInit() && filter_bank[0].Count() > 0) {
+        shape = {filter_bank[0].Count(), out_height, out_width};
+    }
+    return shape;
+}
+
+bool VisualReader::ReadRobotEyesFiltered(void *buffer, size_t size) {
+    /*
+        Read a set of images and write the filter bank responses into the given buffer
+
+        params: void *buffer            -- caller owned buffer for the filter responses; elements of the output type
+                size_t size             -- number of elements in the buffer
+
+        return: bool                    -- return True, if successful
+    */
+
+    if (CheckInit()) {
+        if (filter_bank[0].Count() == 0) {
+            std::cerr << "[Visual Reader] No filter bank is selected! Call SetGaborFilters or SetDoGFilters first." << std::endl;
+            return false;
+        }
+        size_t filter_size = static_cast<size_t>(filter_bank[0].Count()) * out_width * out_height;
+        size_t total_size = GetOutputShape()[0] * filter_size;
+        if (size != total_size) {
+            std::cerr << "[Visual Reader] Buffer size " << size << " does not match the filter output size " << total_size << "!" << std::endl;
+            return false;
+        }
+
+        return ReadEyes([this](int eye_idx, uint8_t *out) { return ReadEyeFiltered(eye_idx, out); }, static_cast<uint8_t *>(buffer),
+                        filter_size * out_elem_size);
+    }
+    return false;
+}
+
 void VisualReader::Close() {
     /*
         Close module by closing the ports and shutdown gRPC connection
@@ -437,143 +965,350 @@ void VisualReader::Close() {
     }
 #endif
 
-    // close Ports
-    // disconnect and close left eye port
-    if (!port_left.isClosed()) {
-        yarp::os::Network::disconnect(robot_port_name_l, port_left.getName());
-        port_left.close();
-    }
+    // stop the worker thread of the binocular mode
+    eye_worker.reset();
 
-    // disconnect and close right eye port
-    if (!port_right.isClosed()) {
-        yarp::os::Network::disconnect(robot_port_name_r, port_right.getName());
-        port_right.close();
+    // the event reference belongs to the closed image stream
+    event_ref_valid = false;
+
+    // the stereo matcher and the filter bank are configured for the closed output geometry
+    stereo_matcher.reset();
+    filter_pool.reset();
+    filter_bank[0].Clear();
+    filter_bank[1].Clear();
+
+    // release the frames and unsubscribe from the camera sources; the last subscriber closes the port
+    for (int i = 0; i < 2; i++) {
+        last_frame[i].reset();
+        camera[i].reset();
     }
+    capture_threaded = false;
 
     this->dev_init = false;
 }
 
 /*** gRPC related functions ***/
 #ifdef _USE_GRPC
-std::vector<double> VisualReader::provideData() {
-    std::vector<double> img;
+std::vector<uint8_t> VisualReader::provideRawData() {
+    std::vector<uint8_t> img;
+    const yarp::sig::ImageOf<yarp::sig::PixelRgb> *cam_img;
     switch (act_eye) {
         case 'L':
-            iEyeRgb = port_left.read();
+            cam_img = AcquireImage(1);
             break;
         case 'R':
-            iEyeRgb = port_right.read();
+            cam_img = AcquireImage(0);
             break;
         default:
+            return img;
             break;
     }
-    if (iEyeRgb == nullptr) {
+    if (cam_img == nullptr) {
         return img;
     }
-    return ProcessRead();
+    // the image is transferred with the output type -> the transport size scales with the element size
+    img.resize(out_size * out_elem_size);
+    ProcessRead((act_eye == 'R') ? 0 : 1, cam_img, img.data(), out_dtype);
+    return img;
+}
+
+std::vector<int> VisualReader::provideImageGeometry() {
+    auto geometry = processor[0].GetOutputShape();
+    geometry.push_back(static_cast<int>(processor[0].GetLayout()));
+    geometry.push_back(static_cast<int>(out_dtype));
+    return geometry;
 }
 #endif
 
 /*** auxilary methods ***/
-std::vector<VisualReader::precision> VisualReader::ProcessRead() {
-    cv::Mat RgbMat = yarp::cv::toCvMat(*iEyeRgb);
+const yarp::sig::ImageOf<yarp::sig::PixelRgb> *VisualReader::AcquireImage(int eye_idx) {
+    /*
+        Return a camera image of the given eye from the shared camera source and keep the frame until the next call
 
-    cv::cvtColor(RgbMat, tmpMat, colorcode);
+        params: int eye_idx                     -- eye index; 0: right eye, 1: left eye
 
-    // extracting the output part of the field of view
-    if (!cut_img) {
-        ROV = tmpMat;
-    } else {
-        ROV = tmpMat(cv::Rect(out_fov_x_low, out_fov_y_low, rov_width, rov_height)).clone();
+        return: const ImageOf<PixelRgb> *       -- camera image; nullptr if no image was received
+    */
+
+    auto &source = camera[eye_idx];
+    if (!source) {
+        return nullptr;
     }
 
-    // resize ROV to given output resolution
-    if (res_scale_x == 1 && res_scale_x == 1) {
-        monoMat = ROV;
-    } else if (res_scale_x < 1 || res_scale_x < 1) {
-        cv::resize(ROV, monoMat, cv::Size(), res_scale_x, res_scale_y, cv::INTER_AREA);
-    } else {
-        cv::resize(ROV, monoMat, cv::Size(), res_scale_x, res_scale_y, filter_ds);
+    // threaded mode: newest frame, only the very first frame is waited for; direct mode: wait for the next frame to avoid stale images
+    unsigned long long sequence = capture_threaded ? 0 : source->LatestSequence();
+    last_frame[eye_idx] = source->WaitFrame(sequence);
+    if (!last_frame[eye_idx]) {
+        return nullptr;
     }
+    return &last_frame[eye_idx]->image;
+}
+
+std::string VisualReader::ResolveCameraPort(const std::string &side) {
+    /*
+        Return the robot camera port of the given side; the calibrated image port is preferred, if available
+
+        params: std::string side        -- camera side: "right" or "left"
 
-    // normalize the image from 0..255 to 0..1.0
-    monoMat.convertTo(tmpMat1, new_type, norm_fact);
+        return: std::string             -- robot camera port name
+    */
+
+    std::string robot_port_calib = robot_port_prefix + "/camcalib/" + side + "/out";
+    std::string robot_port_name = robot_port_prefix + "/cam/" + side;
+    std::string robot_port_postfix = "/rgbImage:o";
 
-    // flat the image matrix to 1D-vector
-    return MatC2Vec(tmpMat1);
+    if (yarp::os::Network::exists(robot_port_calib)) {
+        return robot_port_calib;
+    } else if (yarp::os::Network::exists(robot_port_name + robot_port_postfix)) {
+        return robot_port_name + robot_port_postfix;
+    }
+    return robot_port_name;
 }
 
-double VisualReader::FovX2PixelX(double fx) {
+bool VisualReader::LoadCameraCalibration(const std::string &calib_file, int eye_idx, std::vector<double> &intrinsics, std::vector<double> &distortion) {
     /*
-        Convert field of view horizontal degree position to horizontal pixel position
+        Load the camera intrinsics and distortion of the given eye from an iCub camera calibration file (e.g. icubEyes.ini),
+        groups CAMERA_CALIBRATION_RIGHT/CAMERA_CALIBRATION_LEFT; the intrinsics are scaled to the iCub image size
 
-        params: double fx   -- horizontal field of view position in degree
+        params: std::string calib_file          -- path of the calibration file
+                int eye_idx                     -- eye index; 0: right eye, 1: left eye
+                std::vector<double> intrinsics  -- fx, fy, cx, cy in pixel
+                std::vector<double> distortion  -- k1, k2, p1, p2, k3
 
-        return: double      -- horizontal field of view position in pixel
+        return: bool                            -- return True, if the calibration was found
     */
-    double pixel;
-    // conversion function retrieved from measured data
-    pixel = 0.0006 * pow(fx, 3) + 4.8056 * fx + 160;
-    return pixel;
+
+    yarp::os::Property calib;
+    if (!calib.fromConfigFile(calib_file)) {
+        std::cerr << "[Visual Reader] Could not read the camera calibration file \"" << calib_file << "\"!" << std::endl;
+        return false;
+    }
+    std::string group_name = (eye_idx == 0) ? "CAMERA_CALIBRATION_RIGHT" : "CAMERA_CALIBRATION_LEFT";
+    yarp::os::Bottle &group = calib.findGroup(group_name);
+    if (group.isNull() || !group.check("fx") || !group.check("fy") || !group.check("cx") || !group.check("cy")) {
+        std::cerr << "[Visual Reader] Camera calibration file has no complete group " << group_name << "!" << std::endl;
+        return false;
+    }
+
+    // the calibration may belong to a different camera resolution
+    double scale_x = group.check("w") ? icub_width / group.find("w").asFloat64() : 1.;
+    double scale_y = group.check("h") ? icub_height / group.find("h").asFloat64() : 1.;
+    intrinsics = {group.find("fx").asFloat64() * scale_x, group.find("fy").asFloat64() * scale_y, group.find("cx").asFloat64() * scale_x,
+                  group.find("cy").asFloat64() * scale_y};
+    distortion.clear();
+    for (auto key : {"k1", "k2", "p1", "p2", "k3"}) {
+        distortion.push_back(group.check(key) ? group.find(key).asFloat64() : 0.);
+    }
+    return true;
 }
 
-double VisualReader::FovY2PixelY(double fy) {
+bool VisualReader::ReadEyes(const std::function<bool(int, uint8_t *)> &read_eye, uint8_t *buffer, size_t stride) {
     /*
-        Convert field of view vertical degree position to vertical pixel position
+        Run the read function for the selected eye(s); in binocular mode both eyes are read in parallel
 
-        params: double fy   -- vertical field of view position in degree
+        params: read_eye                -- function reading and processing one eye (eye index, output pointer)
+                uint8_t *buffer         -- output buffer
+                size_t stride           -- number of buffer bytes per eye
 
-        return: double      -- vertical field of view position in pixel
+        return: bool                    -- return True, if all eyes were read successfully
     */
 
-    double pixel;
-    // conversion function retrieved from measured data
-    pixel = -0.0005 * pow(fy, 3) + 0.0005 * pow(fy, 2) - 4.7269 * fy + 120.0;
-    return pixel;
+    switch (act_eye) {
+        case 'B': {
+            // the buffer order is fixed: right eye first, left eye second; the worker call needs no allocation per frame
+            eye_worker->Start(read_eye, 0, buffer);
+            bool left_ok = read_eye(1, buffer + stride);
+            bool right_ok = eye_worker->Wait();
+            return right_ok && left_ok;
+        }
+
+        case 'L':
+            return read_eye(1, buffer);
+
+        case 'R':
+            return read_eye(0, buffer);
+
+        default:
+            return false;
+    }
 }
 
-std::vector<VisualReader::precision> VisualReader::Mat2Vec(cv::Mat matrix) {
+bool VisualReader::ReadEye(int eye_idx, void *out, ImageDType dtype) {
     /*
-        Convert a 2D-matrix to 1D-vector
+        Read the newest image of the given eye and write the preprocessed image into the output buffer; eyes can be read in parallel,
+        since ports, frame data and processors are separated per eye
 
-        params: cv::Mat matrix                          -- image as 2D-matrix
+        params: int eye_idx                 -- eye index; 0: right eye, 1: left eye
+                void *out                   -- output buffer with space for out_size elements of the given type
+                ImageDType dtype            -- element type of the output buffer
 
-        return: std::vector<VisualReader::precision>    -- image as 1D-vector
+        return: bool                        -- return True, if an image was received
     */
 
-    // convert a 2D-matrix to 1D-vector, distinguish two cases with different methods
-    std::vector<precision> vec;
+    auto *img = AcquireImage(eye_idx);
+    if (img == nullptr) {
+        return false;
+    }
+    ProcessRead(eye_idx, img, out, dtype);
+    return true;
+}
 
-    if (matrix.isContinuous()) {    // faster, only possible when data is continous in memory
-        vec.assign(reinterpret_cast<precision *>(matrix.data), reinterpret_cast<precision *>(matrix.data) + matrix.total());
-    } else {    // slower, but is always possible
-        for (int i = 0; i < matrix.rows; ++i) {
-            vec.insert(vec.begin(), matrix.ptr<precision>(i), matrix.ptr<precision>(i) + matrix.cols);
-        }
+void VisualReader::ProcessRead(int eye_idx, const yarp::sig::ImageOf<yarp::sig::PixelRgb> *image, void *out, ImageDType dtype) {
+    /*
+        Preprocess the camera image (color conversion, cropping, scaling, type conversion) and write it into the output buffer
+
+        params: int eye_idx                 -- eye index; 0: right eye, 1: left eye
+                ImageOf<PixelRgb> *image    -- camera image received from the robot
+                void *out                   -- output buffer with space for out_size elements of the given type
+                ImageDType dtype            -- element type of the output buffer
+    */
+
+    // a new region of view applies from this frame on
+    if (rov_pending[eye_idx]) {
+        std::lock_guard<std::mutex> lock(rov_mutex);
+        std::swap(processor[eye_idx], pending_processor[eye_idx]);
+        rov_pending[eye_idx] = false;
     }
-    return vec;
+
+    // single pass over the image with the resampling tables computed in Init; images with an unexpected size are processed with the OpenCV pipeline
+    auto &proc = processor[eye_idx];
+    if (!proc.Process(image->getRawImage(), image->width(), image->height(), image->getRowSize(), out, dtype)) {
+        proc.ProcessStaged(image->getRawImage(), image->width(), image->height(), image->getRowSize(), out, dtype);
+    }
+}
+
+bool VisualReader::PrepareFilterBank() {
+    /*
+        Check the filter bank preconditions, remove the previous filter bank and start the filter worker threads
+
+        return: bool                    -- return True, if a filter bank can be set
+    */
+
+    if (processor[0].GetLayout() != ImageLayout::CARTESIAN) {
+        std::cerr << "[Visual Reader] The filter bank output is only available for the cartesian layout!" << std::endl;
+        return false;
+    }
+    filter_bank[0].Clear();
+    filter_bank[1].Clear();
+    if (!filter_pool) {
+        filter_pool = std::make_unique<ThreadPool>(std::max(1u, std::thread::hardware_concurrency()));
+    }
+    return true;
 }
 
-std::vector<VisualReader::precision> VisualReader::MatC2Vec(cv::Mat matrix) {
+bool VisualReader::ReadEyeFiltered(int eye_idx, uint8_t *out) {
     /*
-        Convert a multi dimensional matrix to 1D-vector
+        Read the newest image of the given eye and write the filter bank responses into the output buffer
 
-        params: cv::Mat matrix        -- image as matrix
+        params: int eye_idx             -- eye index; 0: right eye, 1: left eye
+                uint8_t *out            -- output buffer for the filter responses of one image; elements of the output type
 
-        return: std::vector<VisualReader::precision>    -- image as 1D-vector
+        return: bool                    -- return True, if an image was received
     */
 
-    // convert a multi dimensional matrix to 1D-vector, distinguish two cases with different methods
-    std::vector<precision> vec;
+    // the filters work on normalized single precision gray images, independent of the output type
+    auto &input = filter_input[eye_idx];
+    input.resize(out_size);
+    if (!ReadEye(eye_idx, input.data(), ImageDType::FLOAT32)) {
+        return false;
+    }
+    cv::Mat image(out_height, out_width, CV_MAKETYPE(CV_32F, out_channels), input.data());
+    if (out_channels == 3) {
+        cv::cvtColor(image, filter_gray[eye_idx], cv::COLOR_BGR2GRAY);
+        image = filter_gray[eye_idx];
+    }
+    filter_bank[eye_idx].Apply(image, out, out_dtype, filter_pool.get());
+    return true;
+}
 
-    if (matrix.isContinuous()) {    // faster, only possible when data is continous in memory
-        vec.assign(reinterpret_cast<precision *>(matrix.data), reinterpret_cast<precision *>(matrix.data) + matrix.total() * matrix.channels());
-    } else {    // slower, but is always possible
-        for (int i = 0; i < matrix.rows; ++i) {
-            vec.insert(vec.begin(), matrix.ptr<precision>(i), matrix.ptr<precision>(i) + matrix.cols * matrix.channels());
+void VisualReader::StereoInput(int eye_idx, const uint8_t *image) {
+    /*
+        Convert the processed image of the given eye to the 8 bit gray input of the stereo matcher
+
+        params: int eye_idx             -- eye index; 0: right eye, 1: left eye
+                uint8_t *image          -- processed image; elements of the output type
+    */
+
+    // floating point images are normalized to [0, 1]
+    cv::Mat img(out_height, out_width, CV_MAKETYPE(ImageDTypeDepth(out_dtype), out_channels), const_cast<uint8_t *>(image));
+    double scale = (out_dtype == ImageDType::UINT8) ? 1. : 255.;
+    if (out_channels == 1) {
+        img.convertTo(stereo_gray[eye_idx], CV_8U, scale);
+    } else {
+        img.convertTo(stereo_color[eye_idx], CV_8U, scale);
+        cv::cvtColor(stereo_color[eye_idx], stereo_gray[eye_idx], cv::COLOR_BGR2GRAY);
+    }
+}
+
+void VisualReader::BuildPyramid(uint8_t *image) {
+    /*
+        Compute the pyramid levels 1..n behind the processed image (level 0) by area downscaling of the respective previous level
+
+        params: uint8_t *image          -- buffer holding level 0 and space for the further levels; elements of the output type
+    */
+
+    const int type = CV_MAKETYPE(ImageDTypeDepth(out_dtype), out_channels);
+    for (size_t l = 1; l < pyramid_level_offsets.size(); l++) {
+        cv::Mat src(pyramid_shapes[2 * (l - 1)], pyramid_shapes[2 * (l - 1) + 1], type, image + pyramid_level_offsets[l - 1] * out_elem_size);
+        cv::Mat dst(pyramid_shapes[2 * l], pyramid_shapes[2 * l + 1], type, image + pyramid_level_offsets[l] * out_elem_size);
+        if (out_dtype == ImageDType::FLOAT16) {
+            // half precision is not supported by cv::resize -> downscale in single precision
+            cv::Mat src_float, dst_float;
+            src.convertTo(src_float, CV_32F);
+            cv::resize(src_float, dst_float, dst.size(), 0, 0, cv::INTER_AREA);
+            dst_float.convertTo(dst, dst.type());
+        } else {
+            cv::resize(src, dst, dst.size(), 0, 0, cv::INTER_AREA);
         }
     }
-    return vec;
+}
+
+cv::Rect VisualReader::FovToRegionOfView(double center_x, double center_y, double fov_width, double fov_height) {
+    /*
+        Compute the region of view in the camera image for a field of view; the borders are rounded into the field of view
+
+        params: double center_x         -- horizontal center of the field of view in degree (positive: right)
+                double center_y         -- vertical center of the field of view in degree (positive: up)
+                double fov_width        -- field of view width in degree
+                double fov_height       -- field of view height in degree
+
+        return: cv::Rect                -- region of view in pixel
+    */
+
+    int x_low = static_cast<int>(ceil(FovX2PixelX(center_x - fov_width / 2.0)));
+    int x_up = static_cast<int>(floor(FovX2PixelX(center_x + fov_width / 2.0)));
+    int y_low = static_cast<int>(ceil(FovY2PixelY(center_y + fov_height / 2.0)));
+    int y_up = static_cast<int>(floor(FovY2PixelY(center_y - fov_height / 2.0)));
+    return cv::Rect(x_low, y_low, x_up - x_low, y_up - y_low);
+}
+
+double VisualReader::FovX2PixelX(double fx) {
+    /*
+        Convert field of view horizontal degree position to horizontal pixel position
+
+        params: double fx   -- horizontal field of view position in degree
+
+        return: double      -- horizontal field of view position in pixel
+    */
+    double pixel;
+    // conversion function retrieved from measured data
+    pixel = 0.0006 * pow(fx, 3) + 4.8056 * fx + 160;
+    return pixel;
+}
+
+double VisualReader::FovY2PixelY(double fy) {
+    /*
+        Convert field of view vertical degree position to vertical pixel position
+
+        params: double fy   -- vertical field of view position in degree
+
+        return: double      -- vertical field of view position in pixel
+    */
+
+    double pixel;
+    // conversion function retrieved from measured data
+    pixel = -0.0005 * pow(fy, 3) + 0.0005 * pow(fy, 2) - 4.7269 * fy + 120.0;
+    return pixel;
 }
 
 std::vector<uint8_t> VisualReader::Mat3D2Vec(cv::Mat matrix) {
@@ -0,0 +1,115 @@
+/*
+ *  Copyright (C) 2019-2024 Torsten Fietzek
+ *
+ *  image_processing_benchmark.cpp is part of the ANNarchy iCub interface
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  The ANNarchy iCub interface is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this headers. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*
+    Benchmark of the Visual Reader image preprocessing -> single pass implementation vs. multi-stage OpenCV pipeline
+    The camera image is a synthetic 320x240 RGB image, therefore no robot/simulator is needed.
+
+    usage: ./image_processing_benchmark [iterations]
+*/
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <opencv2/opencv.hpp>
+#include <string>
+#include <vector>
+
+#include "Image_Processor.hpp"
+
+typedef std::chrono::high_resolution_clock Clock;
+
+struct Setting {
+    std::string name;
+    cv::Rect rov;
+    int out_width, out_height;
+    bool gray;
+    int filter;
+};
+
+template <typename T>
+void run_setting(const Setting &set, const cv::Mat &rgb, int iterations) {
+    ImageProcessor proc;
+    if (!proc.Init(rgb.cols, rgb.rows, set.rov, set.out_width, set.out_height, set.gray, set.filter)) {
+        return;
+    }
+    std::vector<T> out_fused(proc.GetOutputSize()), out_staged(proc.GetOutputSize());
+
+    // warm up
+    proc.Process(rgb.data, rgb.cols, rgb.rows, rgb.step, out_fused.data());
+    proc.ProcessStaged(rgb.data, rgb.cols, rgb.rows, rgb.step, out_staged.data());
+
+    auto t0 = Clock::now();
+    for (int i = 0; i < iterations; i++) {
+        proc.ProcessStaged(rgb.data, rgb.cols, rgb.rows, rgb.step, out_staged.data());
+    }
+    auto t1 = Clock::now();
+    for (int i = 0; i < iterations; i++) {
+        proc.Process(rgb.data, rgb.cols, rgb.rows, rgb.step, out_fused.data());
+    }
+    auto t2 = Clock::now();
+
+    double max_diff = 0.;
+    for (size_t i = 0; i < out_fused.size(); i++) {
+        max_diff = std::max(max_diff, std::abs(static_cast<double>(out_fused[i]) - static_cast<double>(out_staged[i])));
+    }
+
+    double staged_us = std::chrono::duration<double, std::micro>(t1 - t0).count() / iterations;
+    double fused_us = std::chrono::duration<double, std::micro>(t2 - t1).count() / iterations;
+    std::cout << std::left << std::setw(36) << set.name << std::setw(8) << (sizeof(T) == 8 ? "double" : sizeof(T) == 4 ? "float" : "uint8") << std::right << std::fixed
+              << std::setprecision(1) << std::setw(12) << staged_us << std::setw(12) << fused_us << std::setw(10) << std::setprecision(2)
+              << staged_us / fused_us << std::setw(12) << std::setprecision(4) << max_diff << std::endl;
+}
+
+int main(int argc, char *argv[]) {
+    int iterations = (argc > 1) ? std::atoi(argv[1]) : 1000;
+
+    // synthetic camera image with smooth structure and noise
+    cv::Mat rgb(240, 320, CV_8UC3);
+    cv::RNG rng(42);
+    for (int y = 0; y < rgb.rows; y++) {
+        for (int x = 0; x < rgb.cols; x++) {
+            rgb.at<cv::Vec3b>(y, x) = cv::Vec3b(cv::saturate_cast<uint8_t>(x * 0.8 + rng.uniform(0, 20)), cv::saturate_cast<uint8_t>(y + rng.uniform(0, 20)),
+                                                cv::saturate_cast<uint8_t>(128 + 100 * std::sin(0.1 * (x + y))));
+        }
+    }
+
+    std::vector<Setting> settings = {
+        {"full fov, 320x240 (no scaling)", cv::Rect(0, 0, 320, 240), 320, 240, true, cv::INTER_LINEAR},
+        {"full fov, 160x120 (area)", cv::Rect(0, 0, 320, 240), 160, 120, true, cv::INTER_LINEAR},
+        {"full fov, 80x60 (area)", cv::Rect(0, 0, 320, 240), 80, 60, true, cv::INTER_LINEAR},
+        {"crop 144x96, 320x240 (linear)", cv::Rect(88, 72, 144, 96), 320, 240, true, cv::INTER_LINEAR},
+        {"crop 144x96, 320x240 (cubic)", cv::Rect(88, 72, 144, 96), 320, 240, true, cv::INTER_CUBIC},
+        {"full fov, 160x120 (area, color)", cv::Rect(0, 0, 320, 240), 160, 120, false, cv::INTER_LINEAR},
+        {"crop 144x96, 320x240 (linear, color)", cv::Rect(88, 72, 144, 96), 320, 240, false, cv::INTER_LINEAR},
+    };
+
+    std::cout << "Image preprocessing benchmark; " << iterations << " iterations per setting; time per image in microseconds" << std::endl;
+    std::cout << std::left << std::setw(36) << "setting" << std::setw(8) << "type" << std::right << std::setw(12) << "staged" << std::setw(12) << "fused"
+              << std::setw(10) << "speedup" << std::setw(12) << "max diff" << std::endl;
+    for (const auto &set : settings) {
+        run_setting<float>(set, rgb, iterations);
+        run_setting<double>(set, rgb, iterations);
+        run_setting<uint8_t>(set, rgb, iterations);
+    }
+    return 0;
+}
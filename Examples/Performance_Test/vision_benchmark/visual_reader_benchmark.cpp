@@ -0,0 +1,260 @@
+/*
+ *  Copyright (C) 2019-2024 Torsten Fietzek
+ *
+ *  visual_reader_benchmark.cpp is part of the ANNarchy iCub interface
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  The ANNarchy iCub interface is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this headers. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*
+    Benchmark of the Visual Reader processing path with YARP camera frames (ImageOf<PixelRgb>), but without yarpserver or simulator.
+    The frames are synthetic or loaded from recorded images and fed into:
+        - the multi-stage pipeline of the image processor (ProcessStaged): color conversion, crop, resize, normalization
+        - the single pass image processor used by the Visual Reader (Process)
+    The region of view is computed with the field of view conversion of the Visual Reader. Both pipelines process every frame; the order
+    alternates per iteration, so that neither pipeline always finds the frame in the cache.
+    For every field of view/resolution/output type/filter combination the latency percentiles are reported in microseconds.
+
+    usage: ./visual_reader_benchmark [-n iterations] [-o results.csv] [recorded images ...]
+*/
+
+#include <yarp/sig/Image.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <opencv2/opencv.hpp>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "Image_Processor.hpp"
+#include "Visual_Reader.hpp"
+
+typedef std::chrono::high_resolution_clock Clock;
+
+/** fix iCub camera data -> same as in the Visual Reader **/
+const int icub_width = 320;
+const int icub_height = 240;
+
+struct Setting {
+    double fov_width, fov_height;    // output field of view in degree
+    int out_width, out_height;       // output image size in pixel
+    ImageDType dtype;                // output element type
+    int filter;                      // interpolation flag for upscaling
+};
+
+/** timed pipelines **/
+enum Stage { STAGED = 0, FUSED, N_STAGES };
+const char *stage_names[N_STAGES] = {"staged", "fused"};
+
+std::string DTypeName(ImageDType dtype) {
+    switch (dtype) {
+        case ImageDType::UINT8:
+            return "uint8";
+        case ImageDType::FLOAT16:
+            return "float16";
+        case ImageDType::FLOAT32:
+            return "float32";
+        case ImageDType::FLOAT64:
+            return "float64";
+    }
+    return "";
+}
+
+double Percentile(std::vector<double> values, double p) {
+    /*
+        Return the given percentile of the values (nearest rank)
+    */
+
+    if (values.empty()) {
+        return 0.;
+    }
+    std::sort(values.begin(), values.end());
+    size_t rank = static_cast<size_t>(std::ceil(p / 100. * values.size()));
+    return values[std::min(std::max(rank, static_cast<size_t>(1)), values.size()) - 1];
+}
+
+void ToYarpImage(const cv::Mat &rgb, yarp::sig::ImageOf<yarp::sig::PixelRgb> &frame) {
+    /*
+        Copy an RGB image with the iCub camera size into a YARP camera frame
+    */
+
+    frame.resize(rgb.cols, rgb.rows);
+    for (int y = 0; y < rgb.rows; y++) {
+        std::memcpy(frame.getRow(y), rgb.ptr<uint8_t>(y), static_cast<size_t>(rgb.cols) * 3);
+    }
+}
+
+std::vector<yarp::sig::ImageOf<yarp::sig::PixelRgb>> SyntheticFrames(int n_frames) {
+    /*
+        Create a sequence of synthetic camera frames -> moving smooth structure with noise, so that not the same frame is processed every time
+    */
+
+    std::vector<yarp::sig::ImageOf<yarp::sig::PixelRgb>> frames(n_frames);
+    cv::Mat rgb(icub_height, icub_width, CV_8UC3);
+    cv::RNG rng(42);
+    for (int f = 0; f < n_frames; f++) {
+        for (int y = 0; y < rgb.rows; y++) {
+            for (int x = 0; x < rgb.cols; x++) {
+                rgb.at<cv::Vec3b>(y, x) = cv::Vec3b(cv::saturate_cast<uint8_t>((x + 4 * f) * 0.8 + rng.uniform(0, 20)),
+                                                    cv::saturate_cast<uint8_t>(y + rng.uniform(0, 20)),
+                                                    cv::saturate_cast<uint8_t>(128 + 100 * std::sin(0.1 * (x + y + 2 * f))));
+            }
+        }
+        ToYarpImage(rgb, frames[f]);
+    }
+    return frames;
+}
+
+std::vector<yarp::sig::ImageOf<yarp::sig::PixelRgb>> RecordedFrames(const std::vector<std::string> &files) {
+    /*
+        Load recorded camera images; images with another size are scaled to the iCub camera size
+    */
+
+    std::vector<yarp::sig::ImageOf<yarp::sig::PixelRgb>> frames;
+    for (const auto &file : files) {
+        cv::Mat bgr = cv::imread(file, cv::IMREAD_COLOR);
+        if (bgr.empty()) {
+            std::cerr << "Could not load the image " << file << "!" << std::endl;
+            continue;
+        }
+        cv::Mat rgb;
+        cv::cvtColor(bgr, rgb, cv::COLOR_BGR2RGB);
+        if (rgb.cols != icub_width || rgb.rows != icub_height) {
+            cv::resize(rgb, rgb, cv::Size(icub_width, icub_height), 0, 0, cv::INTER_AREA);
+        }
+        frames.emplace_back();
+        ToYarpImage(rgb, frames.back());
+    }
+    return frames;
+}
+
+std::vector<std::vector<double>> RunSetting(const Setting &set, const std::vector<yarp::sig::ImageOf<yarp::sig::PixelRgb>> &frames, int iterations) {
+    /*
+        Process the frames with both pipelines and return the latencies of every pipeline in microseconds
+    */
+
+    std::vector<std::vector<double>> times(N_STAGES);
+    cv::Rect rov = VisualReader::FovToRegionOfView(0., 0., set.fov_width, set.fov_height);
+    ImageProcessor proc;
+    if (!proc.Init(icub_width, icub_height, rov, set.out_width, set.out_height, true, set.filter)) {
+        return times;
+    }
+
+    const size_t out_size = proc.GetOutputSize() * ImageDTypeSize(set.dtype);
+    std::vector<uint8_t> out_staged(out_size), out_fused(out_size);
+
+    auto run = [&](Stage stage, const yarp::sig::ImageOf<yarp::sig::PixelRgb> &frame) {
+        auto t0 = Clock::now();
+        if (stage == STAGED) {
+            proc.ProcessStaged(frame.getRawImage(), frame.width(), frame.height(), frame.getRowSize(), out_staged.data(), set.dtype);
+        } else {
+            proc.Process(frame.getRawImage(), frame.width(), frame.height(), frame.getRowSize(), out_fused.data(), set.dtype);
+        }
+        auto t1 = Clock::now();
+        times[stage].push_back(std::chrono::duration<double, std::micro>(t1 - t0).count());
+    };
+
+    for (int i = 0; i < iterations; i++) {
+        const auto &frame = frames[i % frames.size()];
+        // alternate the order -> the second pipeline of an iteration reads the frame from the cache
+        if (i % 2 == 0) {
+            run(STAGED, frame);
+            run(FUSED, frame);
+        } else {
+            run(FUSED, frame);
+            run(STAGED, frame);
+        }
+    }
+    return times;
+}
+
+int main(int argc, char *argv[]) {
+    int iterations = 500;
+    std::string csv_file;
+    std::vector<std::string> image_files;
+    for (int i = 1; i < argc; i++) {
+        std::string arg = argv[i];
+        if (arg == "-n" && i + 1 < argc) {
+            iterations = std::max(std::atoi(argv[++i]), 1);
+        } else if (arg == "-o" && i + 1 < argc) {
+            csv_file = argv[++i];
+        } else if (arg == "-h" || arg == "--help") {
+            std::cout << "usage: " << argv[0] << " [-n iterations] [-o results.csv] [recorded images ...]" << std::endl;
+            return 0;
+        } else {
+            image_files.push_back(arg);
+        }
+    }
+
+    auto frames = image_files.empty() ? SyntheticFrames(16) : RecordedFrames(image_files);
+    if (frames.empty()) {
+        std::cerr << "No camera frames available!" << std::endl;
+        return 1;
+    }
+
+    std::vector<Setting> settings;
+    for (auto fov : {std::make_pair(60., 48.), std::make_pair(30., 24.)}) {
+        for (auto res : {std::make_pair(320, 240), std::make_pair(160, 120), std::make_pair(64, 48)}) {
+            for (auto dtype : {ImageDType::UINT8, ImageDType::FLOAT16, ImageDType::FLOAT32, ImageDType::FLOAT64}) {
+                for (auto filter : {cv::INTER_LINEAR, cv::INTER_CUBIC}) {
+                    settings.push_back({fov.first, fov.second, res.first, res.second, dtype, filter});
+                }
+            }
+        }
+    }
+
+    std::ofstream csv;
+    if (!csv_file.empty()) {
+        csv.open(csv_file);
+        csv << "fov_width,fov_height,width,height,dtype,filter,stage,p50_us,p90_us,p99_us" << std::endl;
+    }
+
+    std::cout << "Visual Reader processing benchmark; " << frames.size() << (image_files.empty() ? " synthetic" : " recorded") << " frames; " << iterations
+              << " iterations per setting; latency percentiles p50/p90/p99 in microseconds" << std::endl;
+    std::cout << std::left << std::setw(10) << "fov" << std::setw(10) << "size" << std::setw(9) << "dtype" << std::setw(8) << "filter";
+    for (int s = 0; s < N_STAGES; s++) {
+        std::cout << std::right << std::setw(20) << stage_names[s];
+    }
+    std::cout << std::endl;
+
+    for (const auto &set : settings) {
+        auto times = RunSetting(set, frames, iterations);
+        if (times[FUSED].empty()) {
+            continue;
+        }
+        std::string filter = (set.filter == cv::INTER_CUBIC) ? "cubic" : "linear";
+        std::cout << std::left << std::setw(10) << (std::to_string(static_cast<int>(set.fov_width)) + "x" + std::to_string(static_cast<int>(set.fov_height)))
+                  << std::setw(10) << (std::to_string(set.out_width) + "x" + std::to_string(set.out_height)) << std::setw(9) << DTypeName(set.dtype)
+                  << std::setw(8) << filter << std::right << std::fixed << std::setprecision(1);
+        for (int s = 0; s < N_STAGES; s++) {
+            double p50 = Percentile(times[s], 50.), p90 = Percentile(times[s], 90.), p99 = Percentile(times[s], 99.);
+            std::ostringstream cell;
+            cell << std::fixed << std::setprecision(1) << p50 << "/" << p90 << "/" << p99;
+            std::cout << std::setw(20) << cell.str();
+            if (csv.is_open()) {
+                csv << set.fov_width << "," << set.fov_height << "," << set.out_width << "," << set.out_height << "," << DTypeName(set.dtype) << ","
+                    << filter << "," << stage_names[s] << "," << p50 << "," << p90 << "," << p99 << std::endl;
+            }
+        }
+        std::cout << std::endl;
+    }
+    return 0;
+}
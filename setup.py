@@ -244,7 +244,7 @@ else:
 
 # Lists with lib/include directories and names
 include_dir = ["ANN_iCub_Interface/include", "./", yarp_prefix + "/include", cv_include, numpy.get_include()] + grpc_include_dir + special_include
-libs = ["opencv_core", "opencv_imgproc",
+libs = ["opencv_core", "opencv_imgproc", "opencv_calib3d",
         "YARP_dev", "YARP_init", "YARP_math", "YARP_name", "YARP_os", "YARP_run", "YARP_sig"] + grpc_libs
 
 lib_dirs = [yarp_prefix + "/lib"] + grpc_lib_dir + special_lib
@@ -277,9 +277,6 @@ if config['compiler']['pedantic']:
     extra_compile_args.append("-pedantic")
 if config['module_conf']['use_grpc']:
     extra_compile_args += ["-Wl,-rpath,"+root_path+"/ANN_iCub_Interface/grpc/", "-D_USE_GRPC"]
-if config['module_conf']['double_precision']:
-    macros.append(("_DOUBLE_PRECISION", None))
-    # extra_compile_args.append("-D_DOUBLE_PRECISION")
 if log_define:
     extra_compile_args.append("-D_USE_LOG_QUIET")
 
@@ -301,7 +298,7 @@ extensions = [
               extra_compile_args=extra_compile_args,
               extra_link_args=[] + grpc_link_args
               ),
-    Extension("ANN_iCub_Interface.iCub.Joint_Reader", [prefix_cy + "iCub/Joint_Reader.pyx", prefix_cpp + "Joint_Reader.cpp"] + sources,
+    Extension("ANN_iCub_Interface.iCub.Joint_Reader", [prefix_cy + "iCub/Joint_Reader.pyx", prefix_cpp + "Joint_Reader.cpp", prefix_cpp + "Multi_Joint_Reader.cpp", prefix_cpp + "Thread_Pool.cpp"] + sources,
               include_dirs=include_dir,
               libraries=libs,
               library_dirs=lib_dirs,
@@ -328,7 +325,7 @@ extensions = [
               extra_link_args=[] + grpc_link_args
               ),
 
-    Extension("ANN_iCub_Interface.iCub.Visual_Reader", [prefix_cy + "iCub/Visual_Reader.pyx", prefix_cpp + "Visual_Reader.cpp"] + sources,
+    Extension("ANN_iCub_Interface.iCub.Visual_Reader", [prefix_cy + "iCub/Visual_Reader.pyx", prefix_cpp + "Visual_Reader.cpp", prefix_cpp + "Image_Processor.cpp", prefix_cpp + "Filter_Bank.cpp", prefix_cpp + "Thread_Pool.cpp", prefix_cpp + "Camera_Source.cpp"] + sources,
               include_dirs=include_dir,
               libraries=libs,
               library_dirs=lib_dirs,